@@ -3,84 +3,222 @@
 #include <DallasTemperature.h>
 #include "application/SensorController.h"
 #include "application/MenuController.h"
+#include "application/CommandManagerService.h"
+#include "application/ConfigCommandProcessor.h"
+#include "infrastructure/EepromConfigStore.h"
+#include "infrastructure/SerialRxQueue.h"
+#include "infrastructure/SerialTxQueue.h"
+#include "infrastructure/SerialLogger.h"
+#include "infrastructure/BinaryLogger.h"
+#include "infrastructure/AllocationCounter.h"
+#include "infrastructure/CycleCounter.h"
+#include "domain/BootTiming.h"
+#include "domain/BumpArena.h"
+#include "domain/UiText.h"
+
+// 빠른 부팅: 고정 지연 제거, 부팅 메시지 지연 출력 (0으로 빌드하면 기존 동작)
+#ifndef FAST_BOOT_ENABLED
+#define FAST_BOOT_ENABLED 1
+#endif
+
+// 송신 큐가 가득 찼을 때 1: 가장 오래된 줄을 버림, 0: 새 출력을 버림 ('txq' 명령으로 변경 가능)
+#ifndef TX_QUEUE_DROP_OLDEST
+#define TX_QUEUE_DROP_OLDEST 0
+#endif
 
 constexpr uint8_t ONE_WIRE_BUS = 2;
 OneWire oneWire(ONE_WIRE_BUS);
 DallasTemperature sensors(&oneWire);
 unsigned long lastPrint = 0;
 
-// 컨트롤러 인스턴스
-SensorController sensorController;
+// 설정 저장소 및 컨트롤러 인스턴스
+EepromConfigStore configStore;
+SensorController sensorController(&configStore);
 MenuController menuController;
 bool firstLoop = true;
 
+// 모든 출력은 송신 큐를 거쳐 loop()에서 송신 여유만큼 전송 ('txq' 명령으로 통계 조회)
+SerialTxQueue serialOut(Serial, TX_QUEUE_DROP_OLDEST ? SerialTxQueue::OverflowPolicy::DropOldest
+                                                     : SerialTxQueue::OverflowPolicy::DropNew);
+
+// 진단 로그 (LOG_* 매크로, -D LOG_LEVEL=0으로 빌드해야 DEBUG 출력이 포함됨)
+// LOG_TRACE는 RAM 링에 바이너리로 기록 ('trace' 명령으로 덤프), 텍스트 로그는 송신 큐로 출력
+SerialLogger serialLogger(serialOut);
+BinaryLogger systemLogger(&serialLogger);
+
+// 수신: loop()마다 도착한 바이트를 모두 링에 옮기고 완성된 줄을 큐에 쌓음 ('txq' 명령으로 통계 조회)
+SerialRxQueue serialIn(Serial);
+
+// 시리얼 입력 줄 처리: 한 줄 설정 명령(set/get/dump/stats/help)은 바로 실행하고 나머지 줄은 메뉴로 전달
+ConfigCommandProcessor configCommands(&sensorController);
+CommandManagerService commandManager(&configCommands, &systemLogger);
+
+// loop() 1회 동안만 쓰는 작업 버퍼 (JSON 문서, 텔레메트리 프레임), 매 loop() 시작 시 비움 ('mem' 명령으로 조회)
+alignas(BumpArena::DEFAULT_ALIGNMENT) uint8_t cycleArenaBuffer[CYCLE_ARENA_SIZE];
+BumpArena cycleArena(cycleArenaBuffer, sizeof(cycleArenaBuffer));
+
+// 부팅 단계별 시간 기록 ('boot' 명령으로 조회)
+BootTiming bootTiming = {};
+bool bootOutputPending = true;
+
 void setup()
 {
-    Serial.begin(115200);
+    SerialLogger::beginCrashLog(); // 보존 로그 세션 시작 (이전 세션 줄은 유지)
+    Serial.begin(SERIAL_DEFAULT_BAUD);
+#if !FAST_BOOT_ENABLED
     delay(100); // 시리얼 안정화 대기
+#endif
+    bootTiming.serialReadyMs = millis();
+    CycleCounter::enable(); // 출력/처리 비용 측정용 DWT 사이클 카운터
+    bootTiming.fastBoot = FAST_BOOT_ENABLED;
+
+    // 부팅 메시지도 송신 큐에 쌓고 loop()에서 전송 (초기화/첫 측정을 지연시키지 않음)
+    Print &out = serialOut;
+    sensorController.setConsole(&serialOut);
+    sensorController.setAlarmConsole(&serialOut.priority());
+    configCommands.setResponseCallback([](const char *line) { serialOut.println(line); });
+    commandManager.setFallbackHandler([](const char *line) { menuController.handleInputLine(line); });
+    commandManager.initialize();
+
+    out.println();
+    out.println(ui(UiText::BOOT_BANNER));
+    if (SerialLogger::getPreviousSessionLines() > 0)
+    {
+        out.print(ui(UiText::BOOT_CRASHLOG_FOUND));
+        out.print(SerialLogger::getPreviousSessionLines());
+        out.println(ui(UiText::BOOT_CRASHLOG_HINT));
+    }
+    LOG_INFO(&systemLogger, "부팅 세션 ", SerialLogger::getCrashLog().header.session);
+    out.println(ui(UiText::BOOT_STEP_SERIAL));
     
-    Serial.println();
-    Serial.println("=== DS18B20 시스템 시작 ===");
-    Serial.println("1. 시리얼 통신 초기화 완료");
-    
-    setupSerialAndSensor();
-    
-    Serial.println("2. 센서 및 EEPROM 초기화 완료");
+    setupSerialAndSensor(out);
     
+    out.println(ui(UiText::BOOT_STEP_SENSORS));
+
+    // 첫 온도 변환을 바로 시작 (완료는 loop()에서 확인)
+    sensorController.startConversion();
+    bootTiming.setupDoneMs = millis();
+
+#if !FAST_BOOT_ENABLED
     // 추가 안전장치: setup 완료 후 1초 대기하여 시리얼 통신 안정화
     delay(500);
     
     // 강제로 Normal 상태 확인 및 설정
     menuController.resetToNormalState();
-    
-    Serial.println("3. 메뉴 컨트롤러 초기화 완료");
-    Serial.println("=== 시스템 초기화 완료 ===");
-    Serial.print("현재 AppState: ");
-    Serial.println((int)menuController.getAppState());
-    Serial.println("센서 제어 메뉴 진입: 'menu' 또는 'm' 입력");
-    Serial.println();
+#endif
+
+    out.println(ui(UiText::BOOT_STEP_MENU));
+    out.println(ui(UiText::BOOT_DONE));
+
+#if !FAST_BOOT_ENABLED
+    serialOut.drainAll();
+    finishBootOutput();
+#endif
 }
 
 void loop()
 {
-    menuController.handleSerialInput();
+    cycleArena.reset(); // 이전 loop()에서 받은 작업 버퍼를 모두 반납
+    serialIn.poll();    // 도착한 입력을 모두 수신 큐로 (부팅 출력 중에도 받아 두고 처리만 미룸)
+
+    // 할당 계측 빌드: 부팅 출력 이후 정상 동작 구간의 malloc 호출을 loop() 단위로 확인
+    bool countAllocations = AllocationCounter::ENABLED && !bootOutputPending;
+    if (countAllocations)
+        AllocationCounter::beginCycle();
+
+#if FAST_BOOT_ENABLED
+    // 부팅 메시지가 모두 전송될 때까지는 입력 처리를 미루고 측정만 진행
+    if (bootOutputPending)
+    {
+        serialOut.drain();
+        if (serialOut.isEmpty())
+        {
+            menuController.resetToNormalState();
+            finishBootOutput();
+        }
+    }
+    else
+#endif
+    {
+        menuController.update();
+        commandManager.update();
+        configCommands.update(); // 스크립트 모드 입력 시간 초과
+    }
+    configStore.update(); // 예약된 설정 기록을 조금씩 처리 (write-behind)
+    sensorController.updateSensorDiscovery(); // 백그라운드 센서 검색 (1회당 장치 1개)
     unsigned long now = millis();
     if (menuController.getAppState() == AppState::Normal)
     {
         handleNormalState(now);
     }
+    serialOut.drain(); // 이번 loop()에서 쌓인 출력을 송신 여유만큼 전송
+
+    if (countAllocations)
+        AllocationCounter::endCycle();
 }
 
-void setupSerialAndSensor()
+void finishBootOutput()
 {
-    Serial.print("Firmware build: ");
-    Serial.print(__DATE__);
-    Serial.print(" ");
-    Serial.println(__TIME__);
-    
-    Serial.print("DS18B20 센서 초기화 중...");
-    sensors.begin();
-    Serial.println(" 완료");
+    bootOutputPending = false;
+    serialOut.print(ui(UiText::CURRENT_APP_STATE));
+    serialOut.println((int)menuController.getAppState());
+    serialOut.println(ui(UiText::MENU_HINT));
+    serialOut.println();
+}
+
+void setupSerialAndSensor(Print &out)
+{
+    out.print("Firmware build: ");
+    out.print(__DATE__);
+    out.print(" ");
+    out.println(__TIME__);
     
-    // EEPROM 임계값 초기화 (Serial 초기화 후에 실행)
+    // 설정 저장소에서 임계값/측정 주기 로드 (저널 레코드 한 번에 읽기)
     sensorController.initializeThresholds();
+    bootTiming.configLoadedMs = millis();
+
+    // 저장된 센서 목록으로 빠르게 시작 (없으면 전체 검색) 후 ROM별 설정 레코드 연결
+    out.print(ui(UiText::SENSORS_INITIALIZING));
+    sensorController.beginSensors();
+    bootTiming.sensorsReadyMs = millis();
+
+    // 소프트 리셋/워치독 리셋이면 직전 측정값을 stale 표시로 바로 제공
+    if (sensorController.restoreWarmStart())
+        out.println(ui(UiText::WARM_RESTORED));
     
     // 명시적으로 Normal 상태로 초기화
     menuController.setAppState(AppState::Normal);
-    Serial.println("시스템 상태: Normal 모드");
+    out.println(ui(UiText::STATUS_NORMAL));
 }
 
 void handleNormalState(unsigned long now)
 {
     if (firstLoop)
     {
-        sensorController.printSensorStatusTable();
+        // 부팅 메시지 전송 후 setup()에서 시작한 첫 변환이 끝나면 바로 출력
+        if (bootOutputPending)
+            return;
+        if (!sensorController.isConversionReady())
+        {
+            // 첫 변환 완료 전에는 리셋 이전 값을 1회 출력
+            if (sensorController.printWarmStartTable())
+                lastPrint = now;
+            return;
+        }
+        sensorController.printSensorReport();
         lastPrint = now;
         firstLoop = false;
     }
+    else if (sensorController.isConversionPending())
+    {
+        // 변환이 끝난 뒤의 loop()에서 출력 (대기하는 동안에도 입력/송신 처리 계속)
+        if (sensorController.isConversionReady())
+            sensorController.printSensorReport();
+    }
     else if (now - lastPrint >= sensorController.getMeasurementInterval())
     {
-        sensorController.printSensorStatusTable();
+        // 주기 측정은 변환 요청만 보내고 바로 반환 (requestTemperatures() 대기로 loop()를 막지 않음)
+        sensorController.startConversion();
         lastPrint = now;
     }
 }
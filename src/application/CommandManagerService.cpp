@@ -1,21 +1,21 @@
 #include <Arduino.h>
 #include <cstring>
-#include <cctype>
 #include "CommandManagerService.h"
+#include "../domain/UiText.h"
+#include "../infrastructure/SerialRxQueue.h"
+#include "../infrastructure/SerialTxQueue.h"
+
+extern SerialTxQueue serialOut;
+extern SerialRxQueue serialIn;
 
 CommandManagerService::CommandManagerService(ICommandProcessor *cmdProc, ILogger *log)
-    : commandProcessor(cmdProc), logger(log), bufferIndex(0)
+    : commandProcessor(cmdProc), logger(log), fallbackHandler(nullptr)
 {
-    memset(inputBuffer, 0, sizeof(inputBuffer));
 }
 
 void CommandManagerService::initialize()
 {
-    if (logger)
-    {
-        logger->info("Command Manager Service initialized");
-    }
-    bufferIndex = 0;
+    LOG_DEBUG(logger, "Command Manager Service initialized");
 }
 
 void CommandManagerService::update()
@@ -23,101 +23,37 @@ void CommandManagerService::update()
     processSerialInput();
 }
 
-// 안전한 Serial 읽기를 위한 헬퍼 함수
-static bool safeSerialRead(char &outChar, int &attempts)
-{
-    const int MAX_READ_ATTEMPTS = 3;
-
-    if (attempts >= MAX_READ_ATTEMPTS)
-    {
-        return false; // 최대 시도 횟수 초과
-    }
-
-    if (!Serial.available())
-    {
-        return false; // 데이터 없음
-    }
-
-    int readResult = Serial.read();
-    attempts++;
-
-    if (readResult == -1)
-    {
-        return false; // 읽기 실패
-    }
-
-    // 유효한 ASCII 범위 검증 (보안 강화)
-    if (readResult < 0 || readResult > 127)
-    {
-        return false; // 유효하지 않은 문자
-    }
-
-    outChar = static_cast<char>(readResult);
-    return true;
-}
-
 void CommandManagerService::processSerialInput()
 {
-    // 안전한 입력 처리를 위한 제한값들
-    const int MAX_CHARS_PER_CALL = 32;               // 더 보수적으로 설정
-    const unsigned long MAX_PROCESSING_TIME_MS = 10; // 최대 처리 시간 제한
-
-    unsigned long startTime = millis();
-    int charCount = 0;
-    int readAttempts = 0;
-
-    while (charCount < MAX_CHARS_PER_CALL &&
-           (millis() - startTime) < MAX_PROCESSING_TIME_MS)
+    for (uint8_t processed = 0; processed < MAX_LINES_PER_UPDATE && serialIn.hasLine(); ++processed)
     {
-        char c;
-        if (!safeSerialRead(c, readAttempts))
-        {
-            break; // 안전한 읽기 실패 시 종료
-        }
-
-        charCount++;
-        readAttempts = 0; // 성공적인 읽기 후 시도 횟수 리셋
+        // 역압: 앞선 응답이 송신될 때까지 남은 줄은 수신 큐에 둠
+        if (serialOut.availableForWrite() < RESPONSE_TX_RESERVE)
+            break;
 
-        if (c == '\n' || c == '\r')
-        {
-            if (bufferIndex > 0 && bufferIndex < sizeof(inputBuffer))
-            {
-                inputBuffer[bufferIndex] = '\0';
-                executeCommand(inputBuffer);
-                bufferIndex = 0;
-            }
-        }
-        else if (isprint(c) && bufferIndex < sizeof(inputBuffer) - 2) // 더 보수적인 버퍼 검사
-        {
-            inputBuffer[bufferIndex++] = c;
-        }
-        else if (bufferIndex >= sizeof(inputBuffer) - 2)
-        {
-            // 입력이 버퍼 크기를 초과한 경우
-            inputBuffer[sizeof(inputBuffer) - 1] = '\0';
-            Serial.println("Error: command too long. Buffer overflow prevented.");
-            bufferIndex = 0;
-            break; // 즉시 종료
-        }
+        const SerialRxQueue::Line &line = serialIn.front();
+        if (line.overlong)
+            serialOut.println(ui(UiText::ERR_INPUT_TOO_LONG));
+        else
+            executeCommand(line.text);
+        serialIn.pop();
     }
 }
 
 void CommandManagerService::executeCommand(const char *command)
 {
-    if (!commandProcessor)
-        return;
+    LOG_DEBUG(logger, "Executing command: ", command);
 
-    if (logger)
+    if (commandProcessor && commandProcessor->isValidCommand(command))
     {
-        logger->debug("Executing command");
+        commandProcessor->processCommand(command);
     }
-
-    if (commandProcessor->isValidCommand(command))
+    else if (fallbackHandler)
     {
-        commandProcessor->processCommand(command);
+        fallbackHandler(command);
     }
     else
     {
-        Serial.println("Invalid command. Type 'help' for available commands.");
+        serialOut.println("Invalid command. Type 'help' for available commands.");
     }
 }
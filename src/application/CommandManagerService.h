@@ -7,15 +7,19 @@
 /**
  * @brief 명령어 관리 서비스
  *
- * 시리얼 명령어 파싱 및 실행을 관리하는 어플리케이션 서비스
+ * 수신 큐(SerialRxQueue)에 쌓인 줄을 도착 순서대로 꺼내, 명령 처리기가 아는 명령이면 바로 실행하고
+ * 그 밖의 줄(메뉴 입력)은 대체 처리 함수로 넘기는 어플리케이션 서비스.
+ * 송신 큐 여유가 응답 한 번 분량보다 적으면 다음 줄 처리를 미뤄 응답이 잘리지 않게 한다.
  */
 class CommandManagerService
 {
 private:
+    static constexpr uint8_t MAX_LINES_PER_UPDATE = 4; // update() 1회에 처리할 최대 줄 수
+    static constexpr int RESPONSE_TX_RESERVE = 2048;    // 줄 처리 전 필요한 송신 큐 여유 (메뉴 화면·상태 표 1회분)
+
     ICommandProcessor *commandProcessor;
     ILogger *logger;
-    char inputBuffer[64];
-    int bufferIndex;
+    void (*fallbackHandler)(const char *line);
 
 public:
     CommandManagerService(ICommandProcessor *cmdProc, ILogger *log);
@@ -23,6 +27,7 @@ public:
 
     void initialize();
     void update();
-    void processSerialInput();
+    void processSerialInput(); // 대기 중인 줄 처리 (수신은 loop()의 serialIn.poll())
     void executeCommand(const char *command);
+    void setFallbackHandler(void (*handler)(const char *line)) { fallbackHandler = handler; }
 };
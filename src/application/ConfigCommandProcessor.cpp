@@ -0,0 +1,631 @@
+#include <Arduino.h>
+#include <algorithm>
+#include "ConfigCommandProcessor.h"
+#include "SensorStatusCode.h"
+#include "../domain/Base64.h"
+#include "../domain/BumpArena.h"
+#include "../domain/TextParse.h"
+
+extern BumpArena cycleArena;
+
+namespace
+{
+// 묶음 실행 중 설정 안내문("💾 EEPROM 저장 ..." 등)을 버리는 출력
+class DiscardPrint : public Print
+{
+public:
+    size_t write(uint8_t) override { return 1; }
+    size_t write(const uint8_t *, size_t size) override { return size; }
+};
+
+DiscardPrint discardConsole;
+
+// 범위 안에서 SensorController 안내문을 버림 (소멸 시 원래 출력으로 복원)
+class QuietConsole
+{
+public:
+    explicit QuietConsole(SensorController *sensors) : sensors(sensors), saved(sensors->getConsole())
+    {
+        sensors->setConsole(&discardConsole);
+    }
+    ~QuietConsole() { sensors->setConsole(saved); }
+    QuietConsole(const QuietConsole &) = delete;
+    QuietConsole &operator=(const QuietConsole &) = delete;
+
+private:
+    SensorController *sensors;
+    Print *saved;
+};
+} // namespace
+
+struct ConfigCommandProcessor::Command
+{
+    std::string_view name;
+    void (ConfigCommandProcessor::*handler)(std::string_view args);
+};
+
+// 새 명령은 이름순 위치에 행을 추가한다 (정렬은 컴파일 시 확인)
+constexpr ConfigCommandProcessor::Command ConfigCommandProcessor::COMMANDS[] = {
+    {"batch", &ConfigCommandProcessor::handleBatch},
+    {"dump", &ConfigCommandProcessor::handleDump},
+    {"export", &ConfigCommandProcessor::handleExport},
+    {"get", &ConfigCommandProcessor::handleGet},
+    {"help", &ConfigCommandProcessor::handleHelp},
+    {"import", &ConfigCommandProcessor::handleImport},
+    {"set", &ConfigCommandProcessor::handleSet},
+    {"stats", &ConfigCommandProcessor::handleStats},
+};
+
+constexpr ConfigCommandProcessor::Command ConfigCommandProcessor::SET_COMMANDS[] = {
+    {"interval", &ConfigCommandProcessor::setInterval},
+    {"th", &ConfigCommandProcessor::setThresholds},
+};
+
+constexpr ConfigCommandProcessor::Command ConfigCommandProcessor::BATCH_COMMANDS[] = {
+    {"abort", &ConfigCommandProcessor::abortScript},
+    {"begin", &ConfigCommandProcessor::beginScript},
+    {"end", &ConfigCommandProcessor::endScript},
+};
+
+namespace
+{
+template <typename T, size_t N>
+constexpr size_t countOf(const T (&)[N])
+{
+    return N;
+}
+
+template <typename T, size_t N>
+constexpr bool isSortedByName(const T (&table)[N])
+{
+    for (size_t i = 1; i < N; ++i)
+    {
+        if (!(table[i - 1].name < table[i].name))
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+ConfigCommandProcessor::ConfigCommandProcessor(SensorController *sensors)
+    : sensors(sensors), respond(nullptr), batch{}, importing(false)
+{
+    static_assert(isSortedByName(COMMANDS), "COMMANDS must be sorted by name");
+    static_assert(isSortedByName(SET_COMMANDS), "SET_COMMANDS must be sorted by name");
+    static_assert(isSortedByName(BATCH_COMMANDS), "BATCH_COMMANDS must be sorted by name");
+}
+
+const ConfigCommandProcessor::Command *ConfigCommandProcessor::findCommand(const Command *table, size_t count,
+                                                                           std::string_view name)
+{
+    const Command *end = table + count;
+    const Command *it = std::lower_bound(table, end, name,
+                                         [](const Command &command, std::string_view key) { return command.name < key; });
+    return (it != end && it->name == name) ? it : nullptr;
+}
+
+bool ConfigCommandProcessor::isValidCommand(const char *command) const
+{
+    // 스크립트 모드에서는 모든 줄을 받아 묶음에 포함 (메뉴로 넘기지 않음)
+    if (batch.script)
+        return true;
+    std::string_view rest(command);
+    rest = rest.substr(0, rest.find(';'));
+    return findCommand(COMMANDS, countOf(COMMANDS), TextParse::nextToken(rest)) != nullptr;
+}
+
+void ConfigCommandProcessor::processCommand(const char *command)
+{
+    std::string_view rest(command);
+    if (batch.script)
+        batch.lastInputMs = millis();
+    bool lineBatch = !batch.active && rest.find(';') != std::string_view::npos;
+    if (lineBatch)
+        beginBatch(false);
+
+    // ';'로 나눈 명령을 순서대로 실행 (빈 명령은 건너뜀)
+    while (!rest.empty())
+    {
+        size_t end = rest.find(';');
+        std::string_view part = TextParse::trim(rest.substr(0, end));
+        rest = (end == std::string_view::npos) ? std::string_view() : rest.substr(end + 1);
+        if (part.empty())
+            continue;
+
+        std::string_view name = part;
+        if (batch.active && TextParse::nextToken(name) != "batch")
+            runBatchCommand(part);
+        else
+            dispatch(part);
+    }
+
+    if (lineBatch && batch.active)
+        endBatch();
+}
+
+void ConfigCommandProcessor::update()
+{
+    // 스크립트를 보내던 쪽이 끊기면 묶음이 열린 채로 남아 이후 메뉴 입력까지 삼키지 않도록 끝냄
+    if (batch.script && millis() - batch.lastInputMs >= BATCH_SCRIPT_TIMEOUT_MS)
+        endBatch("timeout");
+}
+
+void ConfigCommandProcessor::dispatch(std::string_view command)
+{
+    std::string_view name = TextParse::nextToken(command);
+    const Command *entry = findCommand(COMMANDS, countOf(COMMANDS), name);
+    if (entry)
+    {
+        (this->*entry->handler)(command);
+        return;
+    }
+    if (batch.active)
+    {
+        sendError("batch", "unknown"); // 요약의 reason=unknown으로 집계
+        return;
+    }
+
+    // 묶음 밖 (예: "batch end; xyz"의 xyz): 명령 이름으로 알림
+    LineBuffer line;
+    line.append("ERR ");
+    for (char c : name)
+        line.append(c);
+    line.append(" unknown");
+    send(line);
+}
+
+void ConfigCommandProcessor::printHelp() const
+{
+    if (!respond)
+        return;
+    respond("# set th <id|rom> <hi> <lo>");
+    respond("# set interval <30|5m|1h30m|1d>");
+    respond("# get <id|rom>");
+    respond("# dump");
+    respond("# stats");
+    respond("# cmd1; cmd2; ...  |  batch begin ... batch end|abort");
+    respond("# export  |  import begin, import <base64>..., import end");
+}
+
+// ========== 묶음 실행 ==========
+
+void ConfigCommandProcessor::beginBatch(bool script)
+{
+    batch = {};
+    batch.active = true;
+    batch.script = script;
+    batch.lastInputMs = millis();
+    sensors->beginConfigTransaction();
+}
+
+void ConfigCommandProcessor::runBatchCommand(std::string_view command)
+{
+    ++batch.commands;
+
+    // 명령별 설정 안내문은 버리고 결과는 요약에만 반영
+    QuietConsole quiet(sensors);
+    dispatch(command);
+}
+
+void ConfigCommandProcessor::endBatch(const char *stopReason)
+{
+    // 묶음 안의 모든 설정 변경을 기록 한 번으로 커밋
+    bool committed;
+    {
+        QuietConsole quiet(sensors);
+        committed = sensors->commitConfigTransaction();
+    }
+
+    Batch result = batch;
+    batch = {};
+
+    LineBuffer line;
+    if (result.errors == 0 && !stopReason)
+    {
+        line.append("OK batch cmds=").appendInt(result.commands);
+    }
+    else
+    {
+        line.append("ERR batch ").append(stopReason ? stopReason : "failed");
+        line.append(" cmds=").appendInt(result.commands);
+        line.append(" errors=").appendInt(result.errors);
+        if (result.errors > 0)
+        {
+            line.append(" at=").appendInt(result.firstErrorAt);
+            line.append(" reason=").append(result.firstErrorReason);
+        }
+    }
+    line.append(" commit=").append(committed ? '1' : '0');
+    send(line);
+}
+
+void ConfigCommandProcessor::handleBatch(std::string_view args)
+{
+    const Command *entry = findCommand(BATCH_COMMANDS, countOf(BATCH_COMMANDS), TextParse::nextToken(args));
+    if (!entry || !TextParse::trim(args).empty())
+    {
+        sendError("batch", "usage");
+        return;
+    }
+    (this->*entry->handler)(args);
+}
+
+void ConfigCommandProcessor::abortScript(std::string_view)
+{
+    // 되돌리기는 없으므로 이미 성공한 변경은 커밋하고 중단 사실만 요약에 남김
+    if (!batch.script)
+    {
+        sendError("batch", "usage");
+        return;
+    }
+    endBatch("aborted");
+}
+
+void ConfigCommandProcessor::beginScript(std::string_view)
+{
+    if (batch.active)
+    {
+        sendError("batch", "usage");
+        return;
+    }
+    beginBatch(true);
+
+    LineBuffer line;
+    line.append("OK batch begin");
+    send(line);
+}
+
+void ConfigCommandProcessor::endScript(std::string_view)
+{
+    if (!batch.script)
+    {
+        sendError("batch", "usage");
+        return;
+    }
+    endBatch();
+}
+
+// ========== 명령 ==========
+
+void ConfigCommandProcessor::handleHelp(std::string_view)
+{
+    printHelp();
+
+    LineBuffer line;
+    line.append("OK help");
+    sendResult(line);
+}
+
+void ConfigCommandProcessor::handleSet(std::string_view args)
+{
+    const Command *entry = findCommand(SET_COMMANDS, countOf(SET_COMMANDS), TextParse::nextToken(args));
+    if (!entry)
+    {
+        sendError("set", "usage");
+        return;
+    }
+    (this->*entry->handler)(args);
+}
+
+void ConfigCommandProcessor::setThresholds(std::string_view args)
+{
+    std::string_view target = TextParse::nextToken(args);
+    float upper;
+    float lower;
+    if (!TextParse::parseDecimal(TextParse::nextToken(args), upper) ||
+        !TextParse::parseDecimal(TextParse::nextToken(args), lower) || !TextParse::trim(args).empty())
+    {
+        sendError("set th", "usage");
+        return;
+    }
+
+    const SensorRowInfo *row = findSensor(target);
+    if (!row)
+    {
+        sendError("set th", "sensor");
+        return;
+    }
+    if (!sensors->isValidTemperature(upper) || !sensors->isValidTemperature(lower))
+    {
+        sendError("set th", "range");
+        return;
+    }
+    if (upper <= lower)
+    {
+        sendError("set th", "order");
+        return;
+    }
+
+    // 응답은 OK/ERR 줄 하나로만 알림 (메뉴용 저장/완료 안내문은 버림)
+    bool saved;
+    {
+        QuietConsole quiet(sensors);
+        saved = sensors->setThresholds(row->rom, upper, lower);
+    }
+    if (!saved)
+    {
+        sendError("set th", "save");
+        return;
+    }
+
+    LineBuffer line;
+    line.append("OK set th id=").appendInt(row->logicalId);
+    line.append(" rom=").appendRomHex(row->addr);
+    line.append(" hi=").appendTenths(toTenths(sensors->getUpperThreshold(row->rom)));
+    line.append(" lo=").appendTenths(toTenths(sensors->getLowerThreshold(row->rom)));
+    sendResult(line);
+}
+
+void ConfigCommandProcessor::setInterval(std::string_view args)
+{
+    std::string_view value = TextParse::nextToken(args);
+    if (value.empty() || !TextParse::trim(args).empty())
+    {
+        sendError("set interval", "usage");
+        return;
+    }
+
+    unsigned long intervalMs = TextParse::parseIntervalMs(value);
+    if (intervalMs == 0 || !sensors->isValidMeasurementInterval(intervalMs))
+    {
+        sendError("set interval", "interval");
+        return;
+    }
+
+    {
+        QuietConsole quiet(sensors);
+        sensors->setMeasurementInterval(intervalMs);
+    }
+
+    LineBuffer line;
+    line.append("OK set interval ms=").appendUInt(sensors->getMeasurementInterval());
+    sendResult(line);
+}
+
+void ConfigCommandProcessor::handleGet(std::string_view args)
+{
+    std::string_view target = TextParse::nextToken(args);
+    if (target.empty() || !TextParse::trim(args).empty())
+    {
+        sendError("get", "usage");
+        return;
+    }
+
+    const SensorRowInfo *row = findSensor(target);
+    if (!row)
+    {
+        sendError("get", "sensor");
+        return;
+    }
+
+    LineBuffer line;
+    appendSensor(line, *row);
+    send(line);
+
+    line.clear();
+    line.append("OK get");
+    sendResult(line);
+}
+
+void ConfigCommandProcessor::handleDump(std::string_view)
+{
+    const SensorRowInfo *rows = sensors->getSortedSensorRows();
+    int count = 0;
+    LineBuffer line;
+    for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
+    {
+        if (!rows[i].connected)
+            continue;
+        line.clear();
+        appendSensor(line, rows[i]);
+        send(line);
+        ++count;
+    }
+
+    line.clear();
+    line.append("OK dump sensors=").appendInt(count);
+    line.append(" interval_ms=").appendUInt(sensors->getMeasurementInterval());
+    sendResult(line);
+}
+
+void ConfigCommandProcessor::handleStats(std::string_view)
+{
+    const SensorRowInfo *rows = sensors->getSortedSensorRows();
+    int connected = 0;
+    for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
+    {
+        if (rows[i].connected)
+            ++connected;
+    }
+
+    LineBuffer line;
+    line.append("OK stats uptime_ms=").appendUInt(millis());
+    line.append(" sensors=").appendInt(connected);
+    line.append(" interval_ms=").appendUInt(sensors->getMeasurementInterval());
+    line.append(" mode=").append(SensorController::getOutputModeName(sensors->getOutputMode()));
+    line.append(" delta=").append(sensors->isDeltaReporting() ? '1' : '0');
+    line.append(" boot=").appendUInt(sensors->getBootGeneration());
+    sendResult(line);
+}
+
+// ========== 설정 복제 ==========
+
+void ConfigCommandProcessor::handleExport(std::string_view args)
+{
+    if (!TextParse::trim(args).empty())
+    {
+        sendError("export", "usage");
+        return;
+    }
+
+    BumpArena::Scope scope(cycleArena);
+    uint8_t *blob = cycleArena.allocateArray<uint8_t>(ConfigBlob::MAX_SIZE);
+    if (!blob)
+    {
+        sendError("export", "memory");
+        return;
+    }
+    size_t length = sensors->exportConfig(blob);
+
+    // 출력 줄이 곧 다른 보드에 보낼 가져오기 명령
+    LineBuffer line;
+    line.append("import begin");
+    send(line);
+    char chunk[base64EncodedLength(BLOB_CHUNK_BYTES) + 1];
+    for (size_t offset = 0; offset < length; offset += BLOB_CHUNK_BYTES)
+    {
+        size_t size = std::min(BLOB_CHUNK_BYTES, length - offset);
+        base64Encode(blob + offset, size, chunk);
+        line.clear();
+        line.append("import ").append(chunk);
+        send(line);
+    }
+    line.clear();
+    line.append("import end");
+    send(line);
+
+    line.clear();
+    line.append("OK export bytes=").appendInt(static_cast<int32_t>(length));
+    // 블롭에 저장된 바이트 순서(리틀 엔디언) 그대로 출력: 디코딩한 블롭의 마지막 두 바이트와 같음
+    line.append(" crc=").appendHexByte(blob[length - 2]).appendHexByte(blob[length - 1]);
+    sendResult(line);
+}
+
+void ConfigCommandProcessor::handleImport(std::string_view args)
+{
+    std::string_view word = TextParse::nextToken(args);
+    if (word.empty() || !TextParse::trim(args).empty())
+    {
+        sendError("import", "usage");
+        return;
+    }
+
+    LineBuffer line;
+    if (word == "begin")
+    {
+        importBlob.clear();
+        importing = true;
+        line.append("OK import begin");
+        sendResult(line);
+        return;
+    }
+    if (!importing)
+    {
+        sendError("import", "usage");
+        return;
+    }
+
+    if (word == "end")
+    {
+        importing = false;
+        bool committed = false;
+        ConfigBlob::Result result;
+        {
+            QuietConsole quiet(sensors);
+            result = sensors->importConfig(importBlob.data(), importBlob.size(), committed);
+        }
+        if (result != ConfigBlob::Result::Ok)
+        {
+            sendError("import", ConfigBlob::resultName(result));
+            return;
+        }
+        line.append("OK import bytes=").appendInt(static_cast<int32_t>(importBlob.size()));
+        line.append(" records=").appendInt(importBlob[1]);
+        line.append(" commit=").append(committed ? '1' : '0');
+        sendResult(line);
+        return;
+    }
+
+    // base64 조각을 이어 붙임 (형식 오류나 길이 초과면 가져오기 중단)
+    uint8_t decoded[BLOB_CHUNK_BYTES];
+    int size = base64Decode(word.data(), word.size(), decoded, sizeof(decoded));
+    if (size < 0)
+    {
+        importing = false;
+        sendError("import", "format");
+        return;
+    }
+    for (int i = 0; i < size; ++i)
+    {
+        if (!importBlob.push_back(decoded[i]))
+        {
+            importing = false;
+            sendError("import", "length");
+            return;
+        }
+    }
+    line.append("OK import bytes=").appendInt(static_cast<int32_t>(importBlob.size()));
+    sendResult(line);
+}
+
+// ========== 보조 ==========
+
+const SensorRowInfo *ConfigCommandProcessor::findSensor(std::string_view token) const
+{
+    // 16자리 16진수는 숫자만으로 이뤄져도 ROM으로 해석 (예: 2800000000000001)
+    long id = 0;
+    uint64_t rom = 0;
+    bool byId = !TextParse::parseRomHex(token, rom);
+    if (byId && !TextParse::parseInteger(token, id))
+        return nullptr;
+
+    // 미할당 센서의 행 ID는 0이므로 범위 밖 ID는 조회 전에 거부
+    if (byId && (id < 1 || id > SENSOR_MAX_COUNT))
+        return nullptr;
+
+    const SensorRowInfo *rows = sensors->getSortedSensorRows();
+    for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
+    {
+        if (rows[i].connected && (byId ? rows[i].logicalId == id : rows[i].rom == rom))
+            return &rows[i];
+    }
+    return nullptr;
+}
+
+// "sensor id=1 rom=... temp=25.13 hi=30.0 lo=20.0 status=ok stale=0" (CSV 보고서와 같은 값·상태 코드)
+void ConfigCommandProcessor::appendSensor(LineBuffer &line, const SensorRowInfo &row)
+{
+    float upper = sensors->getUpperThreshold(row.rom);
+    float lower = sensors->getLowerThreshold(row.rom);
+
+    line.append("sensor id=").appendInt(row.logicalId);
+    line.append(" rom=").appendRomHex(row.addr);
+    line.append(" temp=");
+    if (row.temp == DEVICE_DISCONNECTED_C)
+        line.append("na");
+    else
+        line.appendFixed(toScaled(row.temp, 100), 2);
+    line.append(" hi=").appendTenths(toTenths(upper));
+    line.append(" lo=").appendTenths(toTenths(lower));
+    line.append(" status=").append(statusCode(row.temp, upper, lower));
+    line.append(" stale=").append(row.stale ? '1' : '0');
+}
+
+void ConfigCommandProcessor::send(const LineBuffer &line) const
+{
+    if (respond)
+        respond(line.c_str());
+}
+
+void ConfigCommandProcessor::sendResult(const LineBuffer &line) const
+{
+    if (!batch.active)
+        send(line);
+}
+
+void ConfigCommandProcessor::sendError(const char *command, const char *reason)
+{
+    if (batch.active)
+    {
+        if (batch.errors++ == 0)
+        {
+            batch.firstErrorAt = batch.commands;
+            batch.firstErrorReason = reason;
+        }
+        return;
+    }
+
+    LineBuffer line;
+    line.append("ERR ").append(command).append(' ').append(reason);
+    send(line);
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include <Arduino.h>
+#include <string_view>
+#include "../domain/ICommandProcessor.h"
+#include "../domain/ConfigBlob.h"
+#include "../domain/LineBuffer.h"
+#include "../domain/StaticVector.h"
+#include "SensorController.h"
+
+// 스크립트 모드(batch begin)에서 이 시간 동안 줄이 오지 않으면 받은 데까지 묶음을 끝냄 (ms)
+#ifndef BATCH_SCRIPT_TIMEOUT_MS
+#define BATCH_SCRIPT_TIMEOUT_MS 30000UL
+#endif
+
+/**
+ * @brief 한 줄 설정 명령 처리기 (프로비저닝 스크립트용)
+ *
+ * 메뉴 대화 없이 한 줄로 설정을 바꾸거나 조회한다.
+ *   set th <id|rom> <hi> <lo>   센서 임계값
+ *   set interval <주기>         측정 주기 ("30", "5m", "1h30m")
+ *   get <id|rom>                센서 한 개
+ *   dump                        연결된 센서 전체 + 측정 주기
+ *   stats                       동작 상태 요약
+ *   batch begin / batch end     스크립트 모드 (사이의 모든 줄을 한 묶음으로 실행)
+ *   batch abort                 스크립트 모드를 중단 (이미 성공한 변경은 저장)
+ *   export                      설정 전체를 base64 블롭(CRC 포함)으로 출력
+ *   import begin|<조각>|end     블롭을 받아 검사 후 기록 한 번으로 적용
+ *   help                        명령 목록
+ *
+ * 응답은 key=value 형식이며 명령마다 마지막 줄이 "OK <명령> ..." 또는 "ERR <명령> <사유>"이다
+ * (사유: usage, sensor, range, order, interval, save, unknown, export는 memory, import는 format, length,
+ * crc, version, value). 센서 자료 줄은 "sensor "로 시작한다.
+ * <id>는 논리 ID(1~8), <rom>은 16자리 16진수 ROM 주소이며 연결된 센서만 대상이다.
+ *
+ * 묶음 실행: 한 줄의 "cmd1; cmd2; ..." 또는 batch begin ~ batch end 사이의 줄들은 하나의 설정
+ * 트랜잭션 안에서 순서대로 실행하고, 명령별 결과 줄과 설정 안내문 없이 끝에 요약 한 줄만 보낸다.
+ *   OK batch cmds=<n> commit=<0|1>
+ *   ERR batch failed cmds=<n> errors=<n> at=<첫 실패 순번> reason=<사유> commit=<0|1>
+ * 실패한 명령은 설정을 바꾸지 않고, 성공한 명령의 변경은 기록 한 번으로 저장된다 (되돌림 없음).
+ * 스크립트 모드 동안 명령이 아닌 줄은 메뉴로 넘기지 않고 reason=unknown 오류로 센다.
+ * batch abort 또는 BATCH_SCRIPT_TIMEOUT_MS 동안 입력이 없으면 받은 데까지 커밋하고 끝낸다.
+ *   ERR batch aborted|timeout cmds=<n> errors=<n> [at=<순번> reason=<사유>] commit=<0|1>
+ *
+ * 설정 복제: export는 블롭을 한 줄에 들어가는 조각으로 나눠 "import begin", "import <조각>"...,
+ * "import end" 줄로 출력하므로 이 줄들을 다른 보드에 그대로 보내면 가져오기가 된다.
+ * 가져오기는 end에서 길이·CRC·값을 모두 검사한 뒤에만 적용한다 (실패 시 설정 변화 없음).
+ */
+class ConfigCommandProcessor : public ICommandProcessor
+{
+public:
+    explicit ConfigCommandProcessor(SensorController *sensors);
+
+    void processCommand(const char *command) override;
+    bool isValidCommand(const char *command) const override; // 첫 명령의 첫 단어가 명령 표에 있거나 스크립트 모드이면 true
+    void printHelp() const override;
+    void setResponseCallback(void (*callback)(const char *)) override { respond = callback; }
+    void update(); // loop()에서 호출, 스크립트 모드 입력 시간 초과 확인
+
+private:
+    // 명령 표 (이름순 정렬, 이진 검색) - 정의는 ConfigCommandProcessor.cpp
+    struct Command;
+    static const Command COMMANDS[];
+    static const Command SET_COMMANDS[];
+    static const Command BATCH_COMMANDS[];
+    static constexpr size_t BLOB_CHUNK_BYTES = 72; // export 한 줄 조각 (base64 96자)
+
+    // 묶음 실행 상태 (한 줄 묶음 또는 스크립트 모드)
+    struct Batch
+    {
+        bool active;
+        bool script; // batch begin ~ batch end
+        uint16_t commands;
+        uint16_t errors;
+        uint16_t firstErrorAt; // 1부터
+        const char *firstErrorReason;
+        unsigned long lastInputMs; // 스크립트 모드 마지막 줄 수신 시각
+    };
+
+    SensorController *sensors;
+    void (*respond)(const char *line);
+    Batch batch;
+    StaticVector<uint8_t, ConfigBlob::MAX_SIZE> importBlob;
+    bool importing; // import begin ~ import end
+
+    static const Command *findCommand(const Command *table, size_t count, std::string_view name);
+
+    void dispatch(std::string_view command);
+    void beginBatch(bool script);
+    void runBatchCommand(std::string_view command);
+    void endBatch(const char *stopReason = nullptr); // stopReason: 스크립트를 끝까지 받지 못한 경우 ("aborted", "timeout")
+
+    void handleBatch(std::string_view args);
+    void handleDump(std::string_view args);
+    void handleExport(std::string_view args);
+    void handleGet(std::string_view args);
+    void handleHelp(std::string_view args);
+    void handleImport(std::string_view args);
+    void handleSet(std::string_view args);
+    void handleStats(std::string_view args);
+    void setInterval(std::string_view args);
+    void setThresholds(std::string_view args);
+    void abortScript(std::string_view args);
+    void beginScript(std::string_view args);
+    void endScript(std::string_view args);
+
+    const SensorRowInfo *findSensor(std::string_view token) const;
+    void appendSensor(LineBuffer &line, const SensorRowInfo &row);
+    void send(const LineBuffer &line) const;
+    void sendResult(const LineBuffer &line) const; // 명령 마지막 줄 (묶음 실행 중에는 요약으로 대체)
+    void sendError(const char *command, const char *reason);
+};
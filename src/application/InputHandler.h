@@ -1,27 +1,19 @@
 #pragma once
 #include <Arduino.h>
+#include "../domain/FixedString.h"
 
-// 안전한 Serial 입력 처리를 위한 클래스
+// 메뉴 입력 한 줄 최대 길이 ('baud2000000' 등 인자 포함 명령)
+constexpr size_t INPUT_LINE_CAPACITY = 16;
+using InputLine = FixedString<INPUT_LINE_CAPACITY>;
+
+// 메뉴 입력 정리 (시리얼 줄 수신은 CommandManagerService가 담당)
 class InputHandler
 {
 public:
-    InputHandler();
-    
-    // 안전한 입력 처리 메서드
-    bool processSerialInput(String& outputBuffer);
-    void clearInputBuffer();
-    
+    // 수신한 한 줄에서 메뉴 문자만 골라 out에 담는다. 메뉴 입력 길이를 넘으면 false (out은 비움)
+    static bool toMenuLine(const char *line, InputLine& out);
+
     // 입력 검증 메서드
     static bool isValidMenuChar(char c);
     static bool isValidSensorIndex(char c);
-    
-private:
-    // 안전한 Serial 읽기를 위한 헬퍼 함수
-    static bool safeSerialRead(char& outChar, int& attempts);
-    
-    // 보안 설정
-    static const int MAX_CHARS_PER_CALL = 16;
-    static const int MAX_INPUT_LENGTH = 8;
-    static const unsigned long MAX_PROCESSING_TIME_MS = 5;
-    static const int MAX_CONSECUTIVE_FAILURES = 5;
-};
\ No newline at end of file
+};
@@ -1,30 +1,69 @@
 #include <Arduino.h>
+#include <cstdlib>
 #include <cstring>
 #include <cctype>
-#include <vector>
 #include <algorithm>
 #include "MenuController.h"
 #include "SensorController.h"
+#include "../domain/BootTiming.h"
+#include "../domain/BumpArena.h"
+#include "../domain/Format.h"
+#include "../domain/LineBuffer.h"
+#include "../domain/LogCatalog.h"
+#include "../domain/TextParse.h"
+#include "../domain/UiText.h"
+#include "../infrastructure/AllocationCounter.h"
+#include "../infrastructure/BinaryLogger.h"
+#include "../infrastructure/SerialLogger.h"
+#include "../infrastructure/SerialRxQueue.h"
+#include "../infrastructure/SerialTxQueue.h"
 #include <OneWire.h>
 #include <DallasTemperature.h>
 
 extern SensorController sensorController;
+extern BootTiming bootTiming;
+extern SerialTxQueue serialOut;
+extern SerialRxQueue serialIn;
+extern BinaryLogger systemLogger;
+extern BumpArena cycleArena;
 extern unsigned long lastPrint;
 extern const unsigned long printInterval;
 
+// 온도/데드밴드 값을 float 출력 경로 대신 고정소수점으로 출력
+static void printFixed(int32_t scaled, uint8_t decimals)
+{
+    char text[Format::TEMPERATURE_SIZE];
+    Format::fixed(text, sizeof(text), scaled, decimals);
+    serialOut.print(text);
+}
+
+static void printCelsius(float value)
+{
+    printFixed(toTenths(value), 1);
+}
+
+static void printIntervalLine(unsigned long intervalMs)
+{
+    char text[Format::INTERVAL_SIZE];
+    Format::interval(text, sizeof(text), intervalMs);
+    serialOut.println(text);
+}
+
 MenuController::MenuController()
     : appState(AppState::Normal),
       selectedSensorIdx(-1),
       selectedDisplayIdx(-1),
-      inputBuffer(""),
-      isMultiSelectMode(false)
+      selectedSensorRom(0),
+      isMultiSelectMode(false),
+      activeBaud(SERIAL_DEFAULT_BAUD),
+      fallbackBaud(SERIAL_DEFAULT_BAUD),
+      baudConfirmDeadline(0)
 {
-    // selectedSensorIndices는 기본 생성자로 빈 벡터로 초기화됨
-    selectedSensorIndices.clear(); // 명시적으로 비우기 (선택사항)
+    // selectedSensorIndices는 기본 생성자로 빈 목록으로 초기화됨
 }
 
 // SensorMenuHandler를 사용하여 복잡도 감소 (static 함수)
-std::vector<int> MenuController::parseSensorIndices(const String &input)
+SensorIndexList MenuController::parseSensorIndices(std::string_view input)
 {
     return SensorMenuHandler::parseSensorIndices(input);
 }
@@ -33,13 +72,13 @@ std::vector<int> MenuController::parseSensorIndices(const String &input)
 #include "SensorController.h"
 void MenuController::printMenu()
 {
-    Serial.println();
-    Serial.println("===== 센서 제어 메뉴 =====");
-    Serial.println("1. 센서 ID 조정");
-    Serial.println("2. 상/하한 온도 조정");
-    Serial.println("3. 센서 측정 주기 조정");
-    Serial.println("4. 취소 / 상태창으로 돌아가기");
-    Serial.print("메뉴 번호를 입력하세요: ");
+    serialOut.println();
+    serialOut.println(ui(UiText::MENU_TITLE));
+    serialOut.println(ui(UiText::MENU_ITEM_SENSOR_ID));
+    serialOut.println(ui(UiText::MENU_ITEM_THRESHOLD));
+    serialOut.println(ui(UiText::MENU_ITEM_INTERVAL));
+    serialOut.println(ui(UiText::MENU_ITEM_EXIT));
+    serialOut.print(ui(UiText::PROMPT_MENU_NUMBER));
 }
 
 void MenuController::printSensorIdMenu()
@@ -48,1254 +87,1285 @@ void MenuController::printSensorIdMenu()
     sensorMenuHandler.printSensorIdMenu();
 }
 
-void MenuController::handleSerialInput()
+void MenuController::handleInputLine(const char *line)
 {
-    // InputHandler를 사용하여 복잡도 감소
-    if (inputHandler.processSerialInput(inputBuffer))
+    if (!InputHandler::toMenuLine(line, inputBuffer))
     {
-        processInputBuffer();
+        serialOut.println(ui(UiText::ERR_INPUT_TOO_LONG));
+        return;
     }
+
+    // 메뉴 문자가 없는 줄은 무시
+    if (!inputBuffer.isEmpty())
+        processInputBuffer();
+}
+
+void MenuController::update()
+{
+    checkBaudConfirmTimeout();
 }
 
 void MenuController::resetToNormalState()
 {
     appState = AppState::Normal;
-    inputBuffer = "";
+    inputBuffer.clear();
     selectedSensorIdx = -1;
     selectedDisplayIdx = -1;
     selectedSensorIndices.clear();
     isMultiSelectMode = false;
-    Serial.println("[DEBUG] 상태가 Normal로 완전히 리셋되었습니다.");
-    Serial.println("[시스템 준비 완료 - Normal 모드에서 대기 중]");
+    LOG_DEBUG(&systemLogger, "상태가 Normal로 완전히 리셋되었습니다.");
+    serialOut.println(ui(UiText::SYSTEM_READY));
 }
 
-void MenuController::handleNormalState()
+bool MenuController::handleNormalState()
 {
-    if (inputBuffer == "menu" || inputBuffer == "MENU" || inputBuffer == "m" || inputBuffer == "M")
-    {
-        appState = AppState::Menu;
-        Serial.println("[DEBUG] appState -> Menu");
-        printMenu();
-    }
-    else if (inputBuffer == "reset" || inputBuffer == "RESET" || inputBuffer == "r" || inputBuffer == "R")
+    if (inputBuffer == "reset" || inputBuffer == "RESET" || inputBuffer == "r" || inputBuffer == "R")
     {
         // 강제 리셋 명령어 추가
         resetToNormalState();
         sensorController.printSensorStatusTable();
         lastPrint = millis();
     }
-}
-
-void MenuController::handleMenuState()
-{
-    if (inputBuffer == "1")
+    else if (inputBuffer == "flush" || inputBuffer == "FLUSH")
     {
-        appState = AppState::SensorIdMenu;
-        Serial.println("[DEBUG] appState -> SensorIdMenu");
-        printSensorIdMenu();
+        // 백그라운드 설정 기록 즉시 완료
+        sensorController.flushConfig();
     }
-    else if (inputBuffer == "2")
+    else if (inputBuffer == "boot" || inputBuffer == "BOOT")
     {
-        appState = AppState::ThresholdMenu;
-        Serial.println("[DEBUG] appState -> ThresholdMenu");
-        printThresholdMenu();
+        printBootTiming();
     }
-    else if (inputBuffer == "3")
+    else if (inputBuffer == "perf" || inputBuffer == "PERF")
     {
-        appState = AppState::MeasurementInterval_Input;
-        Serial.println("[DEBUG] appState -> MeasurementInterval_Input");
-        printMeasurementIntervalMenu();
+        printRenderStats();
     }
-    else if (inputBuffer == "4")
+    else if (inputBuffer == "mem" || inputBuffer == "MEM")
     {
-        appState = AppState::Normal;
-        Serial.println("[DEBUG] appState -> Normal");
-        sensorController.printSensorStatusTable();
-        lastPrint = millis();
+        printMemoryStats();
     }
-    else
+    else if (inputBuffer.startsWith("mode"))
     {
-        Serial.println("지원하지 않는 메뉴입니다. 1~4 중 선택하세요.");
-        printMenu();
+        handleOutputModeCommand();
+    }
+    else if (inputBuffer.startsWith("baud"))
+    {
+        handleBaudCommand();
+    }
+    else if (inputBuffer.startsWith("delta"))
+    {
+        handleDeltaCommand();
+    }
+    else if (inputBuffer.startsWith("txq"))
+    {
+        handleTxQueueCommand();
+    }
+    else if (inputBuffer.startsWith("trace"))
+    {
+        handleTraceCommand();
+    }
+    else if (inputBuffer.startsWith("crashlog"))
+    {
+        handleCrashLogCommand();
     }
+    return true;
 }
 
-void MenuController::handleSensorIdMenuState()
+void MenuController::handleOutputModeCommand()
 {
-    if (inputBuffer == "1")
+    // "mode" 조회, "mode table|csv|json" 변경 (설정에 저장)
+    std::string_view arg = TextParse::trim(inputBuffer.view().substr(4));
+
+    if (arg.empty())
     {
-        isMultiSelectMode = false;
-        appState = AppState::SensorIdChange_SelectSensor;
-        Serial.println("[DEBUG] appState -> SensorIdChange_SelectSensor");
-        Serial.println("[개별 센서 ID 변경] 센서 상태창:");
-        sensorController.printSensorStatusTable();
-        Serial.print("변경할 센서 번호(1~8, 취소:c) 입력: ");
+        serialOut.print(ui(UiText::CURRENT_OUTPUT_MODE));
+        serialOut.println(SensorController::getOutputModeName(sensorController.getOutputMode()));
+        serialOut.println(ui(UiText::USAGE_MODE));
     }
-    else if (inputBuffer == "2")
+    else if (TextParse::equalsIgnoreCase(arg, "table"))
     {
-        isMultiSelectMode = true;
-        appState = AppState::SensorIdChange_SelectSensor;
-        Serial.println("[DEBUG] appState -> SensorIdChange_SelectSensor (복수)");
-        Serial.println("[복수 센서 ID 변경] 센서 상태창:");
-        sensorController.printSensorStatusTable();
-        Serial.print("변경할 센서 번호들을 입력하세요 (예: 1 2 3, 취소:c): ");
+        sensorController.setOutputMode(OutputMode::Table);
     }
-    else if (inputBuffer == "3")
+    else if (TextParse::equalsIgnoreCase(arg, "csv"))
     {
-        sensorController.assignIDsByAddress();
-        Serial.println("[자동] 주소순 ID 할당 완료");
-        sensorController.printSensorStatusTable();
-        printSensorIdMenu();
+        sensorController.setOutputMode(OutputMode::Csv);
     }
-    else if (inputBuffer == "4")
+    else if (TextParse::equalsIgnoreCase(arg, "json") || TextParse::equalsIgnoreCase(arg, "jsonl"))
     {
-        // 전체 ID 초기화 확인
-        Serial.println();
-        Serial.println("⚠️  경고: 모든 센서의 ID가 초기화됩니다!");
-        Serial.println("계속하시겠습니까? (y/n): ");
-        appState = AppState::SensorIdChange_ConfirmReset;
-        Serial.println("[DEBUG] appState -> SensorIdChange_ConfirmReset");
+        sensorController.setOutputMode(OutputMode::JsonLines);
     }
-    else if (inputBuffer == "5")
+    else if (TextParse::equalsIgnoreCase(arg, "bin") || TextParse::equalsIgnoreCase(arg, "binary"))
     {
-        appState = AppState::Menu;
-        Serial.println("[DEBUG] appState -> Menu");
-        printMenu();
+        sensorController.setOutputMode(OutputMode::Binary);
     }
-    else if (inputBuffer == "6")
+    else if (TextParse::equalsIgnoreCase(arg, "dash") || TextParse::equalsIgnoreCase(arg, "dashboard"))
     {
-        appState = AppState::Normal;
-        Serial.println("[DEBUG] appState -> Normal");
-        sensorController.printSensorStatusTable();
-        lastPrint = millis();
+        sensorController.setOutputMode(OutputMode::Dashboard);
+        sensorController.printSensorStatusTable(); // 다음 측정까지 기다리지 않고 바로 그림
     }
     else
     {
-        Serial.println("지원하지 않는 메뉴입니다. 1~6 중 선택하세요.");
-        printSensorIdMenu();
+        serialOut.println(ui(UiText::ERR_UNSUPPORTED_MODE));
     }
 }
 
-void MenuController::handleSensorIdSelectState()
+void MenuController::handleBaudCommand()
 {
-    if (inputBuffer == "c" || inputBuffer == "C")
+    // "baud" 조회, "baud <속도>" 변경, "baudok" 새 속도 확인 (저장하지 않음, 리셋 시 기본 속도)
+    std::string_view arg = TextParse::trim(inputBuffer.view().substr(4));
+
+    if (TextParse::equalsIgnoreCase(arg, "ok"))
     {
-        appState = AppState::SensorIdMenu;
-        Serial.println("[DEBUG] appState -> SensorIdMenu");
-        printSensorIdMenu();
+        if (baudConfirmDeadline == 0)
+        {
+            serialOut.println(ui(UiText::BAUD_NOTHING_PENDING));
+            return;
+        }
+        baudConfirmDeadline = 0;
+        fallbackBaud = activeBaud;
+        serialOut.print(ui(UiText::BAUD_CONFIRMED));
+        serialOut.println(activeBaud);
         return;
     }
 
-    if (!validateSensorInput())
+    if (arg.empty())
+    {
+        serialOut.print(ui(UiText::CURRENT_BAUD));
+        serialOut.println(activeBaud);
+        serialOut.println(ui(UiText::USAGE_BAUD));
         return;
+    }
 
-    std::vector<int> indices = parseSensorIndices(inputBuffer);
-    if (!processSensorIndices(indices))
+    unsigned long baud = static_cast<unsigned long>(TextParse::toLong(arg));
+    bool supported = false;
+    for (unsigned long rate : SERIAL_SUPPORTED_BAUDS)
+    {
+        if (rate == baud)
+            supported = true;
+    }
+    if (!supported)
+    {
+        serialOut.println(ui(UiText::ERR_UNSUPPORTED_BAUD));
         return;
+    }
 
-    proceedToSensorConfirmation();
+    // 응답을 현재 속도로 모두 보낸 뒤 전환, 호스트가 새 속도에서 확인하지 않으면 복귀
+    serialOut.print("ACK baud ");
+    serialOut.println(baud);
+    fallbackBaud = activeBaud;
+    applyBaudRate(baud);
+    baudConfirmDeadline = millis() + BAUD_CONFIRM_TIMEOUT_MS;
+    if (baudConfirmDeadline == 0)
+        baudConfirmDeadline = 1;
 }
 
-bool MenuController::validateSensorInput()
+void MenuController::handleDeltaCommand()
 {
-    for (char c : inputBuffer)
-    {
-        if (isspace(c) || (c >= '1' && c <= '8'))
-            continue;
-        // 1-8, 공백 이외의 문자가 있으면 오류
-        Serial.println("[오류] 1~8 사이의 숫자와 공백만 입력하세요.");
-        printSensorSelectionPrompt();
-        return false;
-    }
-    return true;
-}
+    // "delta" 조회, "delta on|off", "delta db <0.01°C>", "delta kf <측정 횟수>" (설정에 저장)
+    std::string_view arg = TextParse::trim(inputBuffer.view().substr(5));
 
-bool MenuController::processSensorIndices(const std::vector<int> &indices)
-{
-    if (indices.empty())
+    if (TextParse::equalsIgnoreCase(arg, "on") || TextParse::equalsIgnoreCase(arg, "off"))
     {
-        Serial.println("[오류] 유효한 센서 번호가 없습니다.");
-        printSensorSelectionPrompt();
-        return false;
+        sensorController.setDeltaReporting(TextParse::equalsIgnoreCase(arg, "on"));
     }
-
-    const auto *sortedRows = sensorController.getSortedSensorRows();
-    selectedSensorIndices.clear();
-    std::vector<int> invalidIndices;
-
-    for (int idx : indices)
+    else if (TextParse::startsWithIgnoreCase(arg, "db"))
     {
-        if (idx >= 1 && idx <= SENSOR_MAX_COUNT && sortedRows[idx - 1].connected)
-        {
-            selectedSensorIndices.push_back(idx);
-        }
-        else
+        long centi = TextParse::toLong(arg.substr(2));
+        if (arg.size() <= 2 || centi < 0 || !sensorController.setDeltaDeadbandCenti(static_cast<uint16_t>(centi)))
         {
-            invalidIndices.push_back(idx);
+            serialOut.print(ui(UiText::ERR_DEADBAND_RANGE));
+            serialOut.print(MAX_DELTA_DEADBAND_CENTI);
+            serialOut.println(ui(UiText::DEADBAND_RANGE_UNIT));
+            return;
         }
     }
-
-    if (!invalidIndices.empty())
+    else if (TextParse::startsWithIgnoreCase(arg, "kf"))
     {
-        Serial.print("[오류] 연결되지 않았거나 잘못된 센서 번호: ");
-        for (size_t i = 0; i < invalidIndices.size(); ++i)
+        long reports = TextParse::toLong(arg.substr(2));
+        if (reports < 1 || reports > 255 || !sensorController.setKeyframeInterval(static_cast<uint8_t>(reports)))
         {
-            Serial.print(invalidIndices[i]);
-            if (i < invalidIndices.size() - 1)
-                Serial.print(", ");
+            serialOut.println(ui(UiText::ERR_KEYFRAME_RANGE));
+            return;
         }
-        Serial.println();
-        printSensorSelectionPrompt();
-        return false;
     }
-
-    if (selectedSensorIndices.empty())
+    else if (!arg.empty())
     {
-        Serial.println("[오류] 선택된 센서가 없습니다.");
-        printSensorSelectionPrompt();
-        return false;
+        serialOut.println(ui(UiText::USAGE_DELTA));
+        return;
     }
 
-    return true;
+    serialOut.print(ui(UiText::DELTA_STATUS));
+    serialOut.print(sensorController.isDeltaReporting() ? "on" : "off");
+    serialOut.print(ui(UiText::DELTA_DEADBAND));
+    printFixed(sensorController.getDeltaDeadbandCenti(), 2);
+    serialOut.print(ui(UiText::DELTA_KEYFRAME));
+    serialOut.print(sensorController.getKeyframeInterval());
+    serialOut.println(ui(UiText::DELTA_KEYFRAME_UNIT));
 }
 
-void MenuController::proceedToSensorConfirmation()
+void MenuController::printMemoryStats()
 {
-    // 복수 선택 모드에서만 선택된 센서 번호 안내
-    if (isMultiSelectMode)
-    {
-        Serial.print("선택된 센서 번호: ");
-        for (int idx : selectedSensorIndices)
-        {
-            Serial.print(idx);
-            Serial.print(" ");
-        }
-        Serial.println();
+    serialOut.println();
+    serialOut.println(ui(UiText::MEM_TITLE));
+    serialOut.print(ui(UiText::MEM_ARENA));
+    serialOut.print(cycleArena.getHighWater());
+    serialOut.print(" / ");
+    serialOut.print(cycleArena.getCapacity());
+    serialOut.print(ui(UiText::MEM_ARENA_FAILED));
+    serialOut.print(cycleArena.getFailedCount());
+    serialOut.println(ui(UiText::MEM_COUNT_SUFFIX));
+
+    if (!AllocationCounter::ENABLED)
+    {
+        serialOut.println(ui(UiText::MEM_ALLOC_DISABLED));
+        return;
     }
-
-    // 첫 번째 센서부터 변경 확인 안내문 출력
-    const auto *sortedRows = sensorController.getSortedSensorRows();
-    selectedDisplayIdx = selectedSensorIndices[0];
-    selectedSensorIdx = sortedRows[selectedDisplayIdx - 1].idx;
-    appState = AppState::SensorIdChange_ConfirmSensor;
-    Serial.println("[DEBUG] appState -> SensorIdChange_ConfirmSensor");
-    Serial.print("센서 ");
-    Serial.print(selectedDisplayIdx);
-    Serial.println("번을 변경할까요? (y/n, 취소:c)");
+    serialOut.print(ui(UiText::MEM_ALLOC_TOTAL));
+    serialOut.print(AllocationCounter::getCount());
+    serialOut.print(ui(UiText::MEM_ALLOC_STEADY));
+    serialOut.print(AllocationCounter::getSteadyStateCount());
+    serialOut.print(ui(UiText::MEM_ALLOC_CYCLES));
+    serialOut.print(AllocationCounter::getSteadyStateCycles());
+    serialOut.println(ui(UiText::MEM_ALLOC_CYCLES_END));
 }
 
-void MenuController::printSensorSelectionPrompt()
+static void printLaneStats(const char *name, const SerialTxQueue::LaneStats &stats)
 {
-    if (isMultiSelectMode)
-        Serial.print("변경할 센서 번호들을 입력하세요 (예: 1 2 3, 취소:c): ");
-    else
-        Serial.print("변경할 센서 번호(1~8, 취소:c) 입력: ");
+    serialOut.print(name);
+    serialOut.print(ui(UiText::TXQ_SENT));
+    serialOut.print(stats.sentBytes);
+    serialOut.print(ui(UiText::TXQ_HIGH_WATER));
+    serialOut.print(stats.highWater);
+    serialOut.print(ui(UiText::TXQ_DROPPED_NEW));
+    serialOut.print(stats.droppedNewBytes);
+    serialOut.print(ui(UiText::TXQ_DROPPED_OLD));
+    serialOut.print(stats.droppedOldBytes);
+    serialOut.println(" B");
 }
 
-void MenuController::handleSensorIdConfirmState()
+void MenuController::handleTxQueueCommand()
 {
-    if (inputBuffer == "y" || inputBuffer == "Y")
-    {
-        handleConfirmYes();
-    }
-    else if (inputBuffer == "n" || inputBuffer == "N" || inputBuffer == "c" || inputBuffer == "C")
-    {
-        handleConfirmNoOrCancel();
-    }
-    else
-    {
-        handleInvalidConfirmInput();
-    }
-}
+    // "txq" 통계 조회, "txq new|oldest" 넘침 정책 변경 (저장하지 않음)
+    std::string_view arg = TextParse::trim(inputBuffer.view().substr(3));
 
-void MenuController::handleSensorIdInputState()
-{
-    if (inputBuffer == "c" || inputBuffer == "C")
+    if (TextParse::equalsIgnoreCase(arg, "new"))
+        serialOut.setOverflowPolicy(SerialTxQueue::OverflowPolicy::DropNew);
+    else if (TextParse::equalsIgnoreCase(arg, "oldest"))
+        serialOut.setOverflowPolicy(SerialTxQueue::OverflowPolicy::DropOldest);
+    else if (!arg.empty())
     {
-        handleCancelInput();
+        serialOut.println(ui(UiText::USAGE_TXQ));
         return;
     }
 
-    int newId = inputBuffer.toInt();
-    if (newId >= 1 && newId <= SENSOR_MAX_COUNT)
-    {
-        processNewSensorId(newId);
-    }
-    else
-    {
-        Serial.println("[오류] ID는 1~8 사이의 숫자여야 합니다.");
-        printIdInputPrompt();
-    }
+    serialOut.println();
+    serialOut.println(ui(UiText::TXQ_TITLE));
+    serialOut.print(ui(UiText::TXQ_POLICY));
+    serialOut.println(serialOut.getOverflowPolicy() == SerialTxQueue::OverflowPolicy::DropOldest
+                          ? ui(UiText::TXQ_POLICY_OLDEST)
+                          : ui(UiText::TXQ_POLICY_NEW));
+    printLaneStats(ui(UiText::TXQ_LANE_BULK), serialOut.getBulkStats());
+    printLaneStats(ui(UiText::TXQ_LANE_PRIORITY), serialOut.getPriorityStats());
+
+    const SerialRxQueue::Stats &rx = serialIn.getStats();
+    serialOut.print(ui(UiText::RXQ_RECEIVED));
+    serialOut.print(rx.receivedBytes);
+    serialOut.print(ui(UiText::RXQ_LINES));
+    serialOut.print(rx.lines);
+    serialOut.print(ui(UiText::RXQ_HIGH_WATER));
+    serialOut.print(rx.ringHighWater);
+    serialOut.print(ui(UiText::RXQ_PEAK_LINES));
+    serialOut.print(rx.lineHighWater);
+    serialOut.print(ui(UiText::RXQ_OVERLONG));
+    serialOut.print(rx.overlongLines);
+    serialOut.print(ui(UiText::RXQ_STALLED));
+    serialOut.println(rx.stalledPolls);
 }
 
-void MenuController::handleCancelInput()
+void MenuController::handleTraceCommand()
 {
-    // 취소 시 다음 센서 확인으로 넘어감
-    auto it = std::find(selectedSensorIndices.begin(), selectedSensorIndices.end(), selectedDisplayIdx);
-    if (it != selectedSensorIndices.end())
+    // "trace" 요약 출력 후 링을 FRAME_LOG 프레임으로 덤프, "trace clear" 비우기
+    std::string_view arg = TextParse::trim(inputBuffer.view().substr(5));
+
+    if (TextParse::equalsIgnoreCase(arg, "clear"))
     {
-        size_t currentIndex = std::distance(selectedSensorIndices.begin(), it);
-        if (currentIndex + 1 < selectedSensorIndices.size())
-        {
-            moveToNextSensor();
-        }
-        else
-        {
-            appState = AppState::SensorIdMenu;
-            Serial.println("[DEBUG] appState -> SensorIdMenu (완료 또는 취소)");
-            printSensorIdMenu();
-        }
+        systemLogger.clear();
+        serialOut.println(ui(UiText::TRACE_CLEARED));
+        return;
     }
-}
-
-bool MenuController::processNewSensorId(int newId)
-{
-    if (sensorController.isIdDuplicated(newId, selectedSensorIdx))
+    if (!arg.empty())
     {
-        Serial.println("[오류] 이미 사용 중인 ID입니다.");
-        printIdInputPrompt();
-        return false;
+        serialOut.println(ui(UiText::USAGE_TRACE));
+        return;
     }
 
-    sensorController.setSensorLogicalId(selectedSensorIdx, newId);
-    Serial.print("센서 ");
-    Serial.print(selectedDisplayIdx);
-    Serial.print("의 ID를 ");
-    Serial.print(newId);
-    Serial.println("(으)로 변경 완료");
-
-    completeIdChange();
-    return true;
+    serialOut.print(ui(UiText::TRACE_RECORDED));
+    serialOut.print(systemLogger.getRecordedCount());
+    serialOut.print(ui(UiText::TRACE_STORED));
+    serialOut.print(systemLogger.getStoredCount());
+    serialOut.print(ui(UiText::TRACE_OVERWRITTEN));
+    serialOut.print(systemLogger.getOverwrittenCount());
+    serialOut.println(ui(UiText::TRACE_COUNT_SUFFIX));
+    systemLogger.dump(serialOut);
 }
 
-void MenuController::moveToNextSensor()
+void MenuController::handleCrashLogCommand()
 {
-    selectedDisplayIdx = selectedSensorIndices[std::distance(selectedSensorIndices.begin(),
-                                                             std::find(selectedSensorIndices.begin(), selectedSensorIndices.end(), selectedDisplayIdx)) +
-                                               1];
-    const auto *sortedRows = sensorController.getSortedSensorRows();
-    selectedSensorIdx = sortedRows[selectedDisplayIdx - 1].idx;
-    appState = AppState::SensorIdChange_ConfirmSensor;
-    Serial.println("[DEBUG] appState -> SensorIdChange_ConfirmSensor (다음 센서)");
-    Serial.print("센서 ");
-    Serial.print(selectedDisplayIdx);
-    Serial.println("번을 변경할까요? (y/n, 취소:c)");
-}
+    // "crashlog" 보존 로그 출력 (이전 세션 줄 표시), "crashlog clear" 비우기
+    std::string_view arg = TextParse::trim(inputBuffer.view().substr(8));
 
-void MenuController::completeIdChange()
-{
-    if (isMultiSelectMode)
+    if (TextParse::equalsIgnoreCase(arg, "clear"))
     {
-        // 복수 선택 모드: 다음 센서로 이동
-        auto it = std::find(selectedSensorIndices.begin(), selectedSensorIndices.end(), selectedDisplayIdx);
-        if (it != selectedSensorIndices.end())
-        {
-            size_t currentIndex = std::distance(selectedSensorIndices.begin(), it);
-            if (currentIndex + 1 < selectedSensorIndices.size())
-            {
-                moveToNextSensor();
-            }
-            else
-            {
-                // 마지막 센서였으면 메뉴로 복귀
-                appState = AppState::SensorIdMenu;
-                Serial.println("[DEBUG] appState -> SensorIdMenu (모두 완료)");
-                sensorController.printSensorStatusTable();
-                printSensorIdMenu();
-            }
-        }
+        SerialLogger::clearCrashLog();
+        serialOut.println(ui(UiText::CRASHLOG_CLEARED));
+        return;
     }
-    else
+    if (!arg.empty())
     {
-        // 개별 선택 모드: 센서 선택 입력 상태로 복귀
-        appState = AppState::SensorIdChange_SelectSensor;
-        Serial.println("[DEBUG] appState -> SensorIdChange_SelectSensor (개별 모드 계속)");
-        Serial.print("변경할 센서 번호(1~8, 취소:c) 입력: ");
+        serialOut.println(ui(UiText::USAGE_CRASHLOG));
+        return;
     }
+
+    const CrashLogRing &ring = SerialLogger::getCrashLog();
+    serialOut.println();
+    serialOut.print(ui(UiText::CRASHLOG_TITLE));
+    serialOut.print(ring.header.session);
+    serialOut.println(ui(UiText::CRASHLOG_TITLE_END));
+
+    uint16_t lines = 0;
+    bool intact = ring.forEachRecord([&lines](bool previousSession, const char *text, size_t length) {
+        if (previousSession)
+            serialOut.print(ui(UiText::CRASHLOG_PREVIOUS));
+        serialOut.write(reinterpret_cast<const uint8_t *>(text), length);
+        serialOut.println();
+        ++lines;
+    });
+
+    if (lines == 0 && intact)
+        serialOut.println(ui(UiText::CRASHLOG_EMPTY));
+    if (!intact)
+        serialOut.println(ui(UiText::CRASHLOG_CORRUPT));
 }
 
-void MenuController::printIdInputPrompt()
+void MenuController::applyBaudRate(unsigned long baud)
 {
-    Serial.print("센서 ");
-    Serial.print(selectedDisplayIdx);
-    Serial.print("의 새로운 ID(1~8, 취소:c)를 입력하세요: ");
+    serialOut.flush(); // 대기 중인 출력은 현재 속도로 모두 전송
+    Serial.end();
+    Serial.begin(baud);
+    activeBaud = baud;
 }
 
-void MenuController::handleConfirmYes()
+void MenuController::checkBaudConfirmTimeout()
 {
-    appState = AppState::SensorIdChange_InputId;
-    Serial.println("[DEBUG] appState -> SensorIdChange_InputId");
-    printIdInputPrompt();
+    if (baudConfirmDeadline == 0 || static_cast<long>(millis() - baudConfirmDeadline) < 0)
+        return;
+
+    baudConfirmDeadline = 0;
+    applyBaudRate(fallbackBaud);
+    serialOut.print(ui(UiText::BAUD_REVERTED));
+    serialOut.println(fallbackBaud);
 }
 
-void MenuController::handleConfirmNoOrCancel()
+void MenuController::printRenderStats()
 {
-    // 복수 선택 모드일 때만 다음 센서로 진행, 아니면 센서 선택 입력 프롬프트로 복귀
-    if (selectedSensorIndices.size() > 1)
-    {
-        moveToNextSensorInConfirm();
-    }
-    else
-    {
-        // 단일 선택 모드: 센서 선택 입력 프롬프트로 복귀
-        appState = AppState::SensorIdChange_SelectSensor;
-        Serial.print("변경할 센서 번호(1~8, 취소:c) 입력:");
+    const TableRenderStats &stats = sensorController.getRenderStats();
+    serialOut.println();
+    serialOut.println(ui(UiText::RENDER_TITLE));
+    serialOut.print(ui(UiText::RENDER_BYTES));
+    serialOut.print(stats.bytes);
+    serialOut.print(ui(UiText::RENDER_LINES));
+    serialOut.print(stats.lines);
+    serialOut.print(ui(UiText::RENDER_WRITES));
+    serialOut.print(stats.lines);
+    serialOut.println(ui(UiText::RENDER_WRITES_END));
+    serialOut.print(ui(UiText::RENDER_CYCLES));
+    serialOut.println(stats.cycles);
+    if (stats.truncatedLines > 0)
+    {
+        serialOut.print(ui(UiText::RENDER_TRUNCATED));
+        serialOut.println(stats.truncatedLines);
     }
 }
 
-void MenuController::handleInvalidConfirmInput()
+void MenuController::printBootTiming()
 {
-    Serial.println("y(예), n(아니오), c(취소) 중 하나를 입력하세요.");
-    Serial.print("센서 ");
-    Serial.print(selectedDisplayIdx);
-    Serial.print("번을 변경할까요? (y/n, 취소:c)");
+    serialOut.println();
+    serialOut.print(ui(UiText::BOOT_TITLE));
+    serialOut.print(bootTiming.fastBoot ? ui(UiText::BOOT_FAST) : ui(UiText::BOOT_FULL));
+    serialOut.println(ui(UiText::BOOT_TITLE_END));
+    serialOut.print(ui(UiText::BOOT_SERIAL));
+    serialOut.println(bootTiming.serialReadyMs);
+    serialOut.print(ui(UiText::BOOT_CONFIG));
+    serialOut.println(bootTiming.configLoadedMs);
+    serialOut.print(ui(UiText::BOOT_SENSORS));
+    serialOut.println(bootTiming.sensorsReadyMs);
+    serialOut.print(ui(UiText::BOOT_SETUP));
+    serialOut.println(bootTiming.setupDoneMs);
+    serialOut.print(ui(UiText::BOOT_FIRST_READING));
+    if (sensorController.getFirstReadingMs() == 0)
+        serialOut.println(ui(UiText::BOOT_WAITING));
+    else
+        serialOut.println(sensorController.getFirstReadingMs());
 }
 
-void MenuController::moveToNextSensorInConfirm()
-{
-    auto it = std::find(selectedSensorIndices.begin(), selectedSensorIndices.end(), selectedDisplayIdx);
-    if (it != selectedSensorIndices.end())
-    {
-        size_t currentIndex = std::distance(selectedSensorIndices.begin(), it);
-        if (currentIndex + 1 < selectedSensorIndices.size())
-        {
-            // 다음 센서로 이동
-            selectedDisplayIdx = selectedSensorIndices[currentIndex + 1];
-            const auto *sortedRows = sensorController.getSortedSensorRows();
-            selectedSensorIdx = sortedRows[selectedDisplayIdx - 1].idx;
-            appState = AppState::SensorIdChange_ConfirmSensor;
-            Serial.println("[DEBUG] appState -> SensorIdChange_ConfirmSensor (다음 센서)");
-            Serial.print("센서 ");
-            Serial.print(selectedDisplayIdx);
-            Serial.println("번을 변경할까요? (y/n, 취소:c)");
-        }
-        else
-        {
-            // 마지막 센서였으면 메뉴로 복귀
-            appState = AppState::SensorIdMenu;
-            Serial.println("[DEBUG] appState -> SensorIdMenu (완료 또는 취소)");
-            printSensorIdMenu();
-        }
-    }
-}
 void MenuController::processInputBuffer()
 {
-    Serial.print("[DEBUG] appState: ");
-    Serial.println((int)appState);
-    Serial.print("[DEBUG] inputBuffer: ");
-    Serial.println(inputBuffer);
+    LOG_DEBUG(&systemLogger, "appState: ", appState, " inputBuffer: ", inputBuffer.c_str());
+    AppState previousState = appState;
 
-    if (handleGlobalResetCommand())
-        return;
+    if (!handleGlobalResetCommand())
+    {
+        processStateBasedInput();
+        inputBuffer.clear();
+    }
 
-    processStateBasedInput();
-    clearInputBuffer();
+    if (appState != previousState)
+        LOG_TRACE(&systemLogger, MENU_STATE, previousState, appState);
 }
 
 bool MenuController::handleGlobalResetCommand()
 {
     if (inputBuffer == "reset" || inputBuffer == "RESET" || inputBuffer == "Reset")
     {
-        Serial.println("[INFO] 강제 리셋 명령어 수신");
+        serialOut.println(ui(UiText::FORCE_RESET));
         resetToNormalState();
         sensorController.printSensorStatusTable();
         lastPrint = millis();
-        clearInputBuffer();
+        inputBuffer.clear();
         return true;
     }
     return false;
 }
 
+// ========== 메뉴 전이 표 ==========
+
+namespace
+{
+constexpr size_t STATE_COUNT = static_cast<size_t>(AppState::COUNT);
+constexpr size_t INPUT_COUNT = static_cast<size_t>(MenuInput::COUNT);
+constexpr uint8_t NO_ROW = 0xFF;
+constexpr AppState STAY = AppState::COUNT; // 다음 상태 열: 상태 유지 (또는 처리 함수가 직접 결정)
+constexpr const char *NO_NOTICE = nullptr; // 안내문 열: 출력 없음
+} // namespace
+
+/**
+ * 전이 표 한 행: (상태, 입력 분류) → 다음 상태, 화면, 처리 함수, 안내문
+ * (1바이트 열을 앞에 모아 32비트 대상에서 한 행 16바이트)
+ *
+ * 처리 함수(없으면 nullptr)를 먼저 실행하고, true이면 안내문 → 상태 전환 → 화면 순으로 출력한다.
+ * 흐름이 입력 값에 따라 갈리는 경우(복수 센서 진행 등)는 다음 상태를 STAY로 두고
+ * 처리 함수가 enterState()를 직접 호출한다.
+ */
+struct MenuController::Transition
+{
+    AppState state;
+    MenuInput input;
+    AppState next;
+    MenuPrompt prompt;
+    bool (MenuController::*action)();
+    const char *notice; // ui()로 컴파일 시 정해진 문자열 (실행 중 UiText 색인 조회 없음)
+};
+
+// 새 메뉴 흐름은 상태를 추가하고 여기에 행을 선언한다 (같은 상태·입력 행은 앞의 것만 사용)
+constexpr MenuController::Transition MenuController::TRANSITIONS[] = {
+    // 정상 출력 중: 'menu'만 표에서 처리, 나머지는 명령 해석
+    {AppState::Normal, MenuInput::MenuWord, AppState::Menu, MenuPrompt::MainMenu, nullptr, NO_NOTICE},
+    {AppState::Normal, MenuInput::Other, STAY, MenuPrompt::None, &MenuController::handleNormalState, NO_NOTICE},
+
+    // 메인 메뉴
+    {AppState::Menu, MenuInput::Choice1, AppState::SensorIdMenu, MenuPrompt::SensorIdMenu, nullptr, NO_NOTICE},
+    {AppState::Menu, MenuInput::Choice2, AppState::ThresholdMenu, MenuPrompt::ThresholdMenu, nullptr, NO_NOTICE},
+    {AppState::Menu, MenuInput::Choice3, AppState::MeasurementInterval_Input, MenuPrompt::IntervalMenu, nullptr, NO_NOTICE},
+    {AppState::Menu, MenuInput::Choice4, AppState::Normal, MenuPrompt::StatusTable, nullptr, NO_NOTICE},
+    {AppState::Menu, MenuInput::Other, STAY, MenuPrompt::MainMenu, nullptr, ui(UiText::ERR_MENU_1_4)},
+
+    // 센서 ID 메뉴
+    {AppState::SensorIdMenu, MenuInput::Choice1, AppState::SensorIdChange_SelectSensor, MenuPrompt::IdSelectSensor, &MenuController::beginSingleIdChange, NO_NOTICE},
+    {AppState::SensorIdMenu, MenuInput::Choice2, AppState::SensorIdChange_SelectSensor, MenuPrompt::IdSelectSensor, &MenuController::beginMultiIdChange, NO_NOTICE},
+    {AppState::SensorIdMenu, MenuInput::Choice3, STAY, MenuPrompt::SensorIdMenu, &MenuController::assignIdsByAddress, NO_NOTICE},
+    {AppState::SensorIdMenu, MenuInput::Choice4, AppState::SensorIdChange_ConfirmReset, MenuPrompt::ResetIdsConfirm, nullptr, NO_NOTICE},
+    {AppState::SensorIdMenu, MenuInput::Choice5, AppState::Menu, MenuPrompt::MainMenu, nullptr, NO_NOTICE},
+    {AppState::SensorIdMenu, MenuInput::Choice6, AppState::Normal, MenuPrompt::StatusTable, nullptr, NO_NOTICE},
+    {AppState::SensorIdMenu, MenuInput::Other, STAY, MenuPrompt::SensorIdMenu, nullptr, ui(UiText::ERR_MENU_1_6)},
+
+    {AppState::SensorIdChange_SelectSensor, MenuInput::Cancel, AppState::SensorIdMenu, MenuPrompt::SensorIdMenu, nullptr, NO_NOTICE},
+    {AppState::SensorIdChange_SelectSensor, MenuInput::Other, AppState::SensorIdChange_ConfirmSensor, MenuPrompt::IdConfirmSensor, &MenuController::selectIdChangeSensors, NO_NOTICE},
+
+    {AppState::SensorIdChange_ConfirmSensor, MenuInput::Yes, AppState::SensorIdChange_InputId, MenuPrompt::IdNewId, nullptr, NO_NOTICE},
+    {AppState::SensorIdChange_ConfirmSensor, MenuInput::No, STAY, MenuPrompt::None, &MenuController::handleConfirmNoOrCancel, NO_NOTICE},
+    {AppState::SensorIdChange_ConfirmSensor, MenuInput::Cancel, STAY, MenuPrompt::None, &MenuController::handleConfirmNoOrCancel, NO_NOTICE},
+    {AppState::SensorIdChange_ConfirmSensor, MenuInput::Other, STAY, MenuPrompt::IdConfirmSensorAgain, nullptr, ui(UiText::CONFIRM_INVALID_YNC)},
+
+    {AppState::SensorIdChange_InputId, MenuInput::Cancel, STAY, MenuPrompt::None, &MenuController::handleCancelInput, NO_NOTICE},
+    {AppState::SensorIdChange_InputId, MenuInput::Other, STAY, MenuPrompt::None, &MenuController::inputNewSensorId, NO_NOTICE},
+
+    {AppState::SensorIdChange_ConfirmReset, MenuInput::Yes, AppState::SensorIdMenu, MenuPrompt::SensorIdMenu, &MenuController::resetAllIds, NO_NOTICE},
+    {AppState::SensorIdChange_ConfirmReset, MenuInput::No, AppState::SensorIdMenu, MenuPrompt::SensorIdMenu, nullptr, ui(UiText::RESET_IDS_CANCELLED)},
+    {AppState::SensorIdChange_ConfirmReset, MenuInput::Other, STAY, MenuPrompt::ResetIdsAgain, nullptr, ui(UiText::CONFIRM_INVALID_YN)},
+
+    // 임계값 메뉴
+    {AppState::ThresholdMenu, MenuInput::Choice1, AppState::ThresholdChange_SelectSensor, MenuPrompt::ThresholdSelectSensor, nullptr, NO_NOTICE},
+    {AppState::ThresholdMenu, MenuInput::Choice2, AppState::ThresholdChange_SelectMultipleSensors, MenuPrompt::ThresholdSelectSensors, nullptr, NO_NOTICE},
+    {AppState::ThresholdMenu, MenuInput::Choice3, STAY, MenuPrompt::ThresholdMenu, &MenuController::resetAllThresholds, NO_NOTICE},
+    {AppState::ThresholdMenu, MenuInput::Choice4, AppState::Menu, MenuPrompt::MainMenu, nullptr, NO_NOTICE},
+    {AppState::ThresholdMenu, MenuInput::Choice5, AppState::Normal, MenuPrompt::StatusTable, nullptr, NO_NOTICE},
+    {AppState::ThresholdMenu, MenuInput::Other, STAY, MenuPrompt::ThresholdMenu, nullptr, ui(UiText::ERR_MENU_1_5)},
+
+    {AppState::ThresholdChange_SelectSensor, MenuInput::Cancel, AppState::ThresholdMenu, MenuPrompt::ThresholdMenu, nullptr, NO_NOTICE},
+    {AppState::ThresholdChange_SelectSensor, MenuInput::Other, AppState::ThresholdChange_InputUpper, MenuPrompt::NewUpper, &MenuController::selectThresholdSensor, NO_NOTICE},
+    {AppState::ThresholdChange_InputUpper, MenuInput::Cancel, AppState::ThresholdMenu, MenuPrompt::ThresholdMenu, nullptr, NO_NOTICE},
+    {AppState::ThresholdChange_InputUpper, MenuInput::Other, AppState::ThresholdChange_InputLower, MenuPrompt::NewLower, &MenuController::inputUpperThreshold, NO_NOTICE},
+    {AppState::ThresholdChange_InputLower, MenuInput::Cancel, AppState::ThresholdMenu, MenuPrompt::ThresholdMenu, nullptr, NO_NOTICE},
+    {AppState::ThresholdChange_InputLower, MenuInput::Other, AppState::ThresholdMenu, MenuPrompt::ThresholdMenu, &MenuController::applyThreshold, NO_NOTICE},
+
+    {AppState::ThresholdChange_SelectMultipleSensors, MenuInput::Cancel, AppState::ThresholdMenu, MenuPrompt::ThresholdMenu, nullptr, NO_NOTICE},
+    {AppState::ThresholdChange_SelectMultipleSensors, MenuInput::Other, AppState::ThresholdChange_ConfirmMultipleSensors, MenuPrompt::SameThresholds, &MenuController::selectThresholdSensors, NO_NOTICE},
+    {AppState::ThresholdChange_ConfirmMultipleSensors, MenuInput::Yes, AppState::ThresholdChange_InputMultipleUpper, MenuPrompt::NewUpper, &MenuController::beginMultipleThresholds, NO_NOTICE},
+    {AppState::ThresholdChange_ConfirmMultipleSensors, MenuInput::No, AppState::ThresholdChange_SelectMultipleSensors, MenuPrompt::ThresholdSensorsAgain, nullptr, NO_NOTICE},
+    {AppState::ThresholdChange_ConfirmMultipleSensors, MenuInput::Cancel, AppState::ThresholdMenu, MenuPrompt::ThresholdMenu, nullptr, NO_NOTICE},
+    {AppState::ThresholdChange_ConfirmMultipleSensors, MenuInput::Other, STAY, MenuPrompt::SameThresholds, nullptr, ui(UiText::CONFIRM_INVALID_YNC)},
+    {AppState::ThresholdChange_InputMultipleUpper, MenuInput::Cancel, AppState::ThresholdMenu, MenuPrompt::ThresholdMenu, nullptr, NO_NOTICE},
+    {AppState::ThresholdChange_InputMultipleUpper, MenuInput::Other, AppState::ThresholdChange_InputMultipleLower, MenuPrompt::NewLower, &MenuController::inputUpperThreshold, NO_NOTICE},
+    {AppState::ThresholdChange_InputMultipleLower, MenuInput::Cancel, AppState::ThresholdMenu, MenuPrompt::ThresholdMenu, nullptr, NO_NOTICE},
+    {AppState::ThresholdChange_InputMultipleLower, MenuInput::Other, AppState::ThresholdMenu, MenuPrompt::ThresholdMenu, &MenuController::applyMultipleThresholds, NO_NOTICE},
+
+    // 측정 주기
+    {AppState::MeasurementIntervalMenu, MenuInput::Other, AppState::MeasurementInterval_Input, MenuPrompt::None, nullptr, NO_NOTICE},
+    {AppState::MeasurementInterval_Input, MenuInput::Cancel, AppState::Menu, MenuPrompt::MainMenu, nullptr, NO_NOTICE},
+    {AppState::MeasurementInterval_Input, MenuInput::Other, AppState::Menu, MenuPrompt::MainMenu, &MenuController::applyMeasurementInterval, NO_NOTICE},
+};
+
+// [상태][입력 분류] → TRANSITIONS 행 번호 (해당 열이 없으면 Other 행, 둘 다 없으면 NO_ROW)
+struct MenuController::DispatchIndex
+{
+    uint8_t row[STATE_COUNT][INPUT_COUNT];
+};
+
+constexpr MenuController::DispatchIndex MenuController::DISPATCH = []
+{
+    constexpr size_t rowCount = sizeof(TRANSITIONS) / sizeof(TRANSITIONS[0]);
+    static_assert(rowCount < NO_ROW, "too many menu transitions");
+
+    DispatchIndex index{};
+    for (size_t s = 0; s < STATE_COUNT; ++s)
+        for (size_t i = 0; i < INPUT_COUNT; ++i)
+            index.row[s][i] = NO_ROW;
+
+    for (size_t r = rowCount; r-- > 0;)
+        index.row[static_cast<size_t>(TRANSITIONS[r].state)][static_cast<size_t>(TRANSITIONS[r].input)] = static_cast<uint8_t>(r);
+
+    const size_t other = static_cast<size_t>(MenuInput::Other);
+    for (size_t s = 0; s < STATE_COUNT; ++s)
+        for (size_t i = 0; i < INPUT_COUNT; ++i)
+            if (index.row[s][i] == NO_ROW)
+                index.row[s][i] = index.row[s][other];
+    return index;
+}();
+
+MenuInput MenuController::classifyInput() const
+{
+    if (inputBuffer == "menu" || inputBuffer == "MENU")
+        return MenuInput::MenuWord;
+    if (inputBuffer.length() != 1)
+        return MenuInput::Other;
+
+    switch (inputBuffer.c_str()[0])
+    {
+    case '1':
+        return MenuInput::Choice1;
+    case '2':
+        return MenuInput::Choice2;
+    case '3':
+        return MenuInput::Choice3;
+    case '4':
+        return MenuInput::Choice4;
+    case '5':
+        return MenuInput::Choice5;
+    case '6':
+        return MenuInput::Choice6;
+    case 'y':
+    case 'Y':
+        return MenuInput::Yes;
+    case 'n':
+    case 'N':
+        return MenuInput::No;
+    case 'c':
+    case 'C':
+        return MenuInput::Cancel;
+    case 'm':
+    case 'M':
+        return MenuInput::MenuWord;
+    default:
+        return MenuInput::Other;
+    }
+}
+
 void MenuController::processStateBasedInput()
 {
-    switch (appState)
+    size_t state = static_cast<size_t>(appState);
+    uint8_t rowIndex = state < STATE_COUNT ? DISPATCH.row[state][static_cast<size_t>(classifyInput())] : NO_ROW;
+    if (rowIndex == NO_ROW)
+    {
+        // 표에 없는 상태인 경우 강제로 Normal 상태로 리셋
+        serialOut.println(ui(UiText::WARN_UNKNOWN_STATE));
+        resetToNormalState();
+        sensorController.printSensorStatusTable();
+        lastPrint = millis();
+        return;
+    }
+
+    const Transition &row = TRANSITIONS[rowIndex];
+    if (row.action && !(this->*row.action)())
+        return;
+
+    if (row.notice != NO_NOTICE)
+        serialOut.println(row.notice);
+    if (row.next == STAY)
+        showPrompt(row.prompt);
+    else
+        enterState(row.next, row.prompt);
+}
+
+void MenuController::enterState(AppState next, MenuPrompt prompt)
+{
+    appState = next;
+    LOG_DEBUG(&systemLogger, "appState -> ", next);
+    showPrompt(prompt);
+}
+
+void MenuController::showPrompt(MenuPrompt prompt)
+{
+    switch (prompt)
     {
-    case AppState::Normal:
-        handleNormalState();
+    case MenuPrompt::None:
+        break;
+    case MenuPrompt::MainMenu:
+        printMenu();
         break;
-    case AppState::Menu:
-        handleMenuState();
+    case MenuPrompt::SensorIdMenu:
+        printSensorIdMenu();
         break;
-    case AppState::SensorIdMenu:
-        handleSensorIdMenuState();
+    case MenuPrompt::ThresholdMenu:
+        printThresholdMenu();
         break;
-    case AppState::SensorIdChange_SelectSensor:
-        handleSensorIdSelectState();
+    case MenuPrompt::IntervalMenu:
+        printMeasurementIntervalMenu();
         break;
-    case AppState::SensorIdChange_ConfirmSensor:
-        handleSensorIdConfirmState();
+    case MenuPrompt::StatusTable:
+        sensorController.printSensorStatusTable();
+        lastPrint = millis();
         break;
-    case AppState::SensorIdChange_InputId:
-        handleSensorIdInputState();
+    case MenuPrompt::IdSelectSensor:
+        serialOut.println(isMultiSelectMode ? ui(UiText::ID_MULTI_TITLE) : ui(UiText::ID_SINGLE_TITLE));
+        sensorController.printSensorStatusTable();
+        printSensorSelectionPrompt();
         break;
-    case AppState::SensorIdChange_ConfirmReset:
-        handleSensorIdConfirmResetState();
+    case MenuPrompt::IdSelectSensorAgain:
+        printSensorSelectionPrompt();
         break;
-    case AppState::ThresholdMenu:
-        handleThresholdMenuState();
+    case MenuPrompt::IdConfirmSensor:
+        serialOut.print(ui(UiText::SENSOR_PREFIX));
+        serialOut.print(selectedDisplayIdx);
+        serialOut.println(ui(UiText::CONFIRM_CHANGE_SENSOR));
         break;
-    case AppState::ThresholdChange_SelectSensor:
-        handleThresholdSelectSensorState();
+    case MenuPrompt::IdConfirmSensorAgain:
+        serialOut.print(ui(UiText::SENSOR_PREFIX));
+        serialOut.print(selectedDisplayIdx);
+        serialOut.print(ui(UiText::CONFIRM_CHANGE_SENSOR));
         break;
-    case AppState::ThresholdChange_InputUpper:
-        handleThresholdInputUpperState();
+    case MenuPrompt::IdNewId:
+        printIdInputPrompt();
         break;
-    case AppState::ThresholdChange_InputLower:
-        handleThresholdInputLowerState();
+    case MenuPrompt::ResetIdsConfirm:
+        serialOut.println();
+        serialOut.println(ui(UiText::WARN_RESET_ALL_IDS));
+        serialOut.println(ui(UiText::PROMPT_CONTINUE));
         break;
-    case AppState::ThresholdChange_SelectMultipleSensors:
-        handleThresholdSelectMultipleSensorsState();
+    case MenuPrompt::ResetIdsAgain:
+        serialOut.print(ui(UiText::PROMPT_RESET_ALL_IDS));
         break;
-    case AppState::ThresholdChange_ConfirmMultipleSensors:
-        handleThresholdConfirmMultipleSensorsState();
+    case MenuPrompt::ThresholdSelectSensor:
+        serialOut.println();
+        serialOut.println(ui(UiText::THRESHOLD_OVERVIEW_TITLE));
+        sensorController.printSensorStatusTable();
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_SENSOR));
         break;
-    case AppState::ThresholdChange_InputMultipleUpper:
-        handleThresholdInputMultipleUpperState();
+    case MenuPrompt::ThresholdSelectSensors:
+        serialOut.println();
+        serialOut.println(ui(UiText::MULTI_THRESHOLD_TITLE));
+        sensorController.printSensorStatusTable();
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_SENSORS));
         break;
-    case AppState::ThresholdChange_InputMultipleLower:
-        handleThresholdInputMultipleLowerState();
+    case MenuPrompt::ThresholdSensorsAgain:
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_SENSORS));
         break;
-    case AppState::MeasurementIntervalMenu:
-        handleMeasurementIntervalMenuState();
+    case MenuPrompt::SameThresholds:
+        serialOut.print(ui(UiText::PROMPT_SAME_THRESHOLDS));
         break;
-    case AppState::MeasurementInterval_Input:
-        handleMeasurementIntervalInputState();
+    case MenuPrompt::NewUpper:
+        serialOut.print(ui(UiText::PROMPT_NEW_UPPER));
+        printCelsius(tempUpperThreshold);
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_RANGE));
         break;
-    default:
-        // 알 수 없는 상태인 경우 강제로 Normal 상태로 리셋
-        Serial.println("[경고] 알 수 없는 상태 감지, Normal 상태로 리셋합니다.");
-        resetToNormalState();
-        sensorController.printSensorStatusTable();
-        lastPrint = millis();
+    case MenuPrompt::NewLower:
+        serialOut.print(ui(UiText::PROMPT_NEW_LOWER));
+        printCelsius(tempLowerThreshold);
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_RANGE));
         break;
     }
 }
 
-void MenuController::clearInputBuffer()
-{
-    inputBuffer = "";
-
-    // 안전한 버퍼 클리어를 위한 제한값들
-    const int MAX_CLEAR_CHARS = 64;            // 더 보수적으로 설정
-    const unsigned long MAX_CLEAR_TIME_MS = 5; // 최대 클리어 시간 제한
+// ========== 센서 ID 변경 ==========
 
-    unsigned long startTime = millis();
-    int clearCount = 0;
-    int consecutiveFailures = 0;
-    const int MAX_CONSECUTIVE_FAILURES = 3;
+bool MenuController::beginSingleIdChange()
+{
+    isMultiSelectMode = false;
+    return true;
+}
+
+bool MenuController::beginMultiIdChange()
+{
+    isMultiSelectMode = true;
+    return true;
+}
+
+bool MenuController::assignIdsByAddress()
+{
+    sensorController.assignIDsByAddress();
+    serialOut.println(ui(UiText::ID_AUTO_ASSIGNED));
+    sensorController.printSensorStatusTable();
+    return true;
+}
+
+bool MenuController::selectIdChangeSensors()
+{
+    if (!validateSensorInput())
+        return false;
+
+    SensorIndexList indices = parseSensorIndices(inputBuffer.view());
+    if (!processSensorIndices(indices))
+        return false;
 
-    // 입력 처리 후 Serial 버퍼 완전 비우기 (테스트 자동화 환경 대응)
-    while (clearCount < MAX_CLEAR_CHARS &&
-           (millis() - startTime) < MAX_CLEAR_TIME_MS &&
-           consecutiveFailures < MAX_CONSECUTIVE_FAILURES)
+    // 복수 선택 모드에서만 선택된 센서 번호 안내
+    if (isMultiSelectMode)
     {
-        if (!Serial.available())
+        serialOut.print(ui(UiText::SELECTED_SENSOR_NUMBERS));
+        for (int idx : selectedSensorIndices)
         {
-            break; // 더 이상 읽을 데이터 없음
+            serialOut.print(idx);
+            serialOut.print(" ");
         }
+        serialOut.println();
+    }
 
-        int readResult = Serial.read();
-        if (readResult == -1)
-        {
-            consecutiveFailures++;
-            continue; // 읽기 실패 시 재시도
-        }
+    // 첫 번째 센서부터 변경 확인
+    const auto *sortedRows = sensorController.getSortedSensorRows();
+    selectedDisplayIdx = selectedSensorIndices[0];
+    selectedSensorIdx = sortedRows[selectedDisplayIdx - 1].idx;
+    return true;
+}
 
-        consecutiveFailures = 0; // 성공적인 읽기 후 실패 카운터 리셋
-        clearCount++;
+bool MenuController::validateSensorInput()
+{
+    for (char c : inputBuffer)
+    {
+        if (isspace(c) || (c >= '1' && c <= '8'))
+            continue;
+        // 1-8, 공백 이외의 문자가 있으면 오류
+        serialOut.println(ui(UiText::ERR_SENSOR_NUMBERS_ONLY));
+        printSensorSelectionPrompt();
+        return false;
     }
+    return true;
 }
 
-void MenuController::handleSensorIdConfirmResetState()
+bool MenuController::processSensorIndices(const SensorIndexList &indices)
 {
-    if (inputBuffer == "y" || inputBuffer == "Y")
+    if (indices.empty())
     {
-        // 전체 ID 초기화 실행
-        sensorController.resetAllSensorIds();
+        serialOut.println(ui(UiText::ERR_NO_VALID_SENSOR_TAG));
+        printSensorSelectionPrompt();
+        return false;
+    }
 
-        // 센서 상태 테이블 출력
-        sensorController.printSensorStatusTable();
+    const auto *sortedRows = sensorController.getSortedSensorRows();
+    selectedSensorIndices.clear();
+    SensorIndexList invalidIndices;
 
-        // 센서 ID 메뉴로 복귀
-        appState = AppState::SensorIdMenu;
-        Serial.println("[DEBUG] appState -> SensorIdMenu");
-        printSensorIdMenu();
+    for (int idx : indices)
+    {
+        if (idx >= 1 && idx <= SENSOR_MAX_COUNT && sortedRows[idx - 1].connected)
+        {
+            selectedSensorIndices.push_back(idx);
+        }
+        else
+        {
+            invalidIndices.push_back(idx);
+        }
     }
-    else if (inputBuffer == "n" || inputBuffer == "N")
+
+    if (!invalidIndices.empty())
     {
-        // 취소 - 센서 ID 메뉴로 복귀
-        Serial.println("전체 ID 초기화가 취소되었습니다.");
-        appState = AppState::SensorIdMenu;
-        Serial.println("[DEBUG] appState -> SensorIdMenu");
-        printSensorIdMenu();
+        serialOut.print(ui(UiText::ERR_INVALID_SENSORS));
+        for (size_t i = 0; i < invalidIndices.size(); ++i)
+        {
+            serialOut.print(invalidIndices[i]);
+            if (i < invalidIndices.size() - 1)
+                serialOut.print(", ");
+        }
+        serialOut.println();
+        printSensorSelectionPrompt();
+        return false;
     }
-    else
+
+    if (selectedSensorIndices.empty())
     {
-        // 잘못된 입력
-        Serial.println("y(예) 또는 n(아니오)를 입력하세요.");
-        Serial.print("모든 센서의 ID를 초기화하시겠습니까? (y/n): ");
+        serialOut.println(ui(UiText::ERR_NO_SENSOR_SELECTED));
+        printSensorSelectionPrompt();
+        return false;
     }
+
+    return true;
 }
 
-// ========== 임계값 설정 메뉴 관련 메서드들 ==========
+void MenuController::printSensorSelectionPrompt()
+{
+    if (isMultiSelectMode)
+        serialOut.print(ui(UiText::PROMPT_SELECT_SENSORS));
+    else
+        serialOut.print(ui(UiText::PROMPT_SELECT_SENSOR));
+}
 
-void MenuController::printThresholdMenu()
+bool MenuController::handleConfirmNoOrCancel()
 {
-    Serial.println();
-    Serial.println("===== 상/하한 온도 조정 메뉴 =====");
-    Serial.println("1. 개별 센서 임계값 설정");
-    Serial.println("2. 복수 센서 임계값 설정");
-    Serial.println("3. 전체 센서 임계값 초기화");
-    Serial.println("4. 이전 메뉴로 돌아가기");
-    Serial.println("5. 상태창으로 돌아가기");
-    Serial.print("메뉴 번호를 입력하세요: ");
+    // 복수 센서를 선택했으면 다음 센서로 진행, 아니면 센서 선택 입력으로 복귀
+    if (selectedSensorIndices.size() > 1)
+        return handleCancelInput();
+
+    enterState(AppState::SensorIdChange_SelectSensor, MenuPrompt::IdSelectSensorAgain);
+    return true;
 }
 
-void MenuController::handleThresholdMenuState()
+bool MenuController::handleCancelInput()
 {
-    if (inputBuffer == "1")
-    {
-        appState = AppState::ThresholdChange_SelectSensor;
-        Serial.println("[DEBUG] appState -> ThresholdChange_SelectSensor");
-        Serial.println();
-        Serial.println("=== 센서별 임계값 현황 ===");
-        sensorController.printSensorStatusTable();
-        Serial.print("임계값을 설정할 센서 번호(1~8, 취소:c)를 입력하세요: ");
-    }
-    else if (inputBuffer == "2")
+    // 취소 시 다음 센서 확인으로 넘어가고, 마지막 센서였으면 센서 ID 메뉴로 복귀
+    auto it = std::find(selectedSensorIndices.begin(), selectedSensorIndices.end(), selectedDisplayIdx);
+    if (it != selectedSensorIndices.end())
     {
-        appState = AppState::ThresholdChange_SelectMultipleSensors;
-        Serial.println("[DEBUG] appState -> ThresholdChange_SelectMultipleSensors");
-        Serial.println();
-        Serial.println("=== 복수 센서 임계값 설정 ===");
-        sensorController.printSensorStatusTable();
-        Serial.print("임계값을 설정할 센서 번호들을 입력하세요 (예: 1 2 3 5, 취소:c): ");
+        size_t currentIndex = std::distance(selectedSensorIndices.begin(), it);
+        if (currentIndex + 1 < selectedSensorIndices.size())
+            moveToNextSensor();
+        else
+            enterState(AppState::SensorIdMenu, MenuPrompt::SensorIdMenu);
     }
-    else if (inputBuffer == "3")
+    return true;
+}
+
+bool MenuController::inputNewSensorId()
+{
+    int newId = TextParse::toLong(inputBuffer.view());
+    if (newId < 1 || newId > SENSOR_MAX_COUNT)
     {
-        Serial.println();
-        Serial.println("⚠️  경고: 모든 센서의 임계값이 기본값으로 초기화됩니다!");
-        Serial.println("계속하시겠습니까? (y/n): ");
-        // 임시로 확인 상태 처리 (간단히 구현)
-        String confirm = "";
-        // 여기서는 바로 실행하도록 간소화
-        sensorController.resetAllThresholds();
-        sensorController.printSensorStatusTable();
-        printThresholdMenu();
+        serialOut.println(ui(UiText::ERR_ID_RANGE_TAG));
+        printIdInputPrompt();
+        return false;
     }
-    else if (inputBuffer == "4")
+    return processNewSensorId(newId);
+}
+
+bool MenuController::processNewSensorId(int newId)
+{
+    if (sensorController.isIdDuplicated(newId, selectedSensorIdx))
     {
-        appState = AppState::Menu;
-        Serial.println("[DEBUG] appState -> Menu");
-        printMenu();
+        serialOut.println(ui(UiText::ERR_ID_IN_USE_TAG));
+        printIdInputPrompt();
+        return false;
     }
-    else if (inputBuffer == "5")
+
+    sensorController.setSensorLogicalId(selectedSensorIdx, newId);
+    serialOut.print(ui(UiText::SENSOR_PREFIX));
+    serialOut.print(selectedDisplayIdx);
+    serialOut.print(ui(UiText::ID_CHANGED_TO));
+    serialOut.print(newId);
+    serialOut.println(ui(UiText::ID_CHANGED_DONE));
+
+    completeIdChange();
+    return true;
+}
+
+void MenuController::moveToNextSensor()
+{
+    selectedDisplayIdx = selectedSensorIndices[std::distance(selectedSensorIndices.begin(),
+                                                             std::find(selectedSensorIndices.begin(), selectedSensorIndices.end(), selectedDisplayIdx)) +
+                                               1];
+    const auto *sortedRows = sensorController.getSortedSensorRows();
+    selectedSensorIdx = sortedRows[selectedDisplayIdx - 1].idx;
+    enterState(AppState::SensorIdChange_ConfirmSensor, MenuPrompt::IdConfirmSensor);
+}
+
+void MenuController::completeIdChange()
+{
+    if (isMultiSelectMode)
     {
-        appState = AppState::Normal;
-        Serial.println("[DEBUG] appState -> Normal");
-        sensorController.printSensorStatusTable();
-        lastPrint = millis();
+        // 복수 선택 모드: 다음 센서로 이동
+        auto it = std::find(selectedSensorIndices.begin(), selectedSensorIndices.end(), selectedDisplayIdx);
+        if (it != selectedSensorIndices.end())
+        {
+            size_t currentIndex = std::distance(selectedSensorIndices.begin(), it);
+            if (currentIndex + 1 < selectedSensorIndices.size())
+            {
+                moveToNextSensor();
+            }
+            else
+            {
+                // 마지막 센서였으면 메뉴로 복귀
+                sensorController.printSensorStatusTable();
+                enterState(AppState::SensorIdMenu, MenuPrompt::SensorIdMenu);
+            }
+        }
     }
     else
     {
-        Serial.println("지원하지 않는 메뉴입니다. 1~5 중 선택하세요.");
-        printThresholdMenu();
+        // 개별 선택 모드: 센서 선택 입력 상태로 복귀
+        enterState(AppState::SensorIdChange_SelectSensor, MenuPrompt::IdSelectSensorAgain);
     }
 }
 
-void MenuController::handleThresholdSelectSensorState()
+void MenuController::printIdInputPrompt()
 {
-    if (inputBuffer == "c" || inputBuffer == "C")
-    {
-        appState = AppState::ThresholdMenu;
-        Serial.println("[DEBUG] appState -> ThresholdMenu");
-        printThresholdMenu();
-        return;
-    }
+    serialOut.print(ui(UiText::SENSOR_PREFIX));
+    serialOut.print(selectedDisplayIdx);
+    serialOut.print(ui(UiText::PROMPT_NEW_ID));
+}
 
-    int sensorNum = inputBuffer.toInt();
-    if (sensorNum >= 1 && sensorNum <= 8)
-    {
-        selectedSensorIdx = sensorNum - 1; // 0-based 인덱스로 변환
+bool MenuController::resetAllIds()
+{
+    // 전체 ID 초기화 후 결과 테이블 출력
+    sensorController.resetAllSensorIds();
+    sensorController.printSensorStatusTable();
+    return true;
+}
 
-        // 현재 임계값 로드
-        tempUpperThreshold = sensorController.getUpperThreshold(selectedSensorIdx);
-        tempLowerThreshold = sensorController.getLowerThreshold(selectedSensorIdx);
+// ========== 임계값 설정 메뉴 관련 메서드들 ==========
+
+void MenuController::printThresholdMenu()
+{
+    serialOut.println();
+    serialOut.println(ui(UiText::THRESHOLD_MENU_TITLE));
+    serialOut.println(ui(UiText::THRESHOLD_MENU_SINGLE));
+    serialOut.println(ui(UiText::THRESHOLD_MENU_MULTI));
+    serialOut.println(ui(UiText::THRESHOLD_MENU_RESET));
+    serialOut.println(ui(UiText::THRESHOLD_MENU_BACK));
+    serialOut.println(ui(UiText::THRESHOLD_MENU_STATUS));
+    serialOut.print(ui(UiText::PROMPT_MENU_NUMBER));
+}
 
-        appState = AppState::ThresholdChange_InputUpper;
-        Serial.println("[DEBUG] appState -> ThresholdChange_InputUpper");
+bool MenuController::resetAllThresholds()
+{
+    serialOut.println();
+    serialOut.println(ui(UiText::WARN_RESET_ALL_THRESHOLDS));
+    serialOut.println(ui(UiText::PROMPT_CONTINUE));
+    // 확인 상태 없이 바로 실행하도록 간소화
+    sensorController.resetAllThresholds();
+    sensorController.printSensorStatusTable();
+    return true;
+}
 
-        Serial.println();
-        Serial.print("📊 센서 ");
-        Serial.print(sensorNum);
-        Serial.println("번 현재 임계값:");
-        Serial.print("   상한(TH): ");
-        Serial.print(tempUpperThreshold, 1);
-        Serial.println("°C");
-        Serial.print("   하한(TL): ");
-        Serial.print(tempLowerThreshold, 1);
-        Serial.println("°C");
-        Serial.println();
-        Serial.print("새로운 상한 임계값 입력 (현재: ");
-        Serial.print(tempUpperThreshold, 1);
-        Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-    }
-    else
+bool MenuController::selectThresholdSensor()
+{
+    int sensorNum = TextParse::toLong(inputBuffer.view());
+    if (sensorNum < 1 || sensorNum > 8)
     {
-        Serial.println("❌ 오류: 1~8 사이의 숫자를 입력하세요.");
-        Serial.print("임계값을 설정할 센서 번호(1~8, 취소:c)를 입력하세요: ");
+        serialOut.println(ui(UiText::ERR_SENSOR_NUMBER_RANGE));
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_SENSOR));
+        return false;
     }
-}
 
-void MenuController::handleThresholdInputUpperState()
-{
-    if (inputBuffer == "c" || inputBuffer == "C")
+    // 표시 행 번호를 센서 ROM 주소로 변환 (임계값은 센서에 귀속)
+    if (!sensorController.getDisplayRowRom(sensorNum, selectedSensorRom))
     {
-        appState = AppState::ThresholdMenu;
-        Serial.println("[DEBUG] appState -> ThresholdMenu");
-        printThresholdMenu();
-        return;
+        serialOut.println(ui(UiText::ERR_ROW_NOT_CONNECTED));
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_SENSOR));
+        return false;
     }
 
+    // 현재 임계값 로드
+    tempUpperThreshold = sensorController.getUpperThreshold(selectedSensorRom);
+    tempLowerThreshold = sensorController.getLowerThreshold(selectedSensorRom);
+
+    serialOut.println();
+    serialOut.print(ui(UiText::STATS_SENSOR_PREFIX));
+    serialOut.print(sensorNum);
+    serialOut.println(ui(UiText::CURRENT_THRESHOLDS));
+    serialOut.print(ui(UiText::LABEL_UPPER_TH));
+    printCelsius(tempUpperThreshold);
+    serialOut.println("°C");
+    serialOut.print(ui(UiText::LABEL_LOWER_TL));
+    printCelsius(tempLowerThreshold);
+    serialOut.println("°C");
+    serialOut.println();
+    return true;
+}
+
+bool MenuController::inputUpperThreshold()
+{
     // 빈 입력 (엔터만) - 기존값 유지
     if (inputBuffer.length() == 0)
     {
-        Serial.print("상한값 유지: ");
-        Serial.print(tempUpperThreshold, 1);
-        Serial.println("°C");
+        serialOut.print(ui(UiText::UPPER_KEPT));
+        printCelsius(tempUpperThreshold);
+        serialOut.println("°C");
+        return true;
     }
-    else
-    {
-        // 숫자 검증
-        float newUpper = inputBuffer.toFloat();
-        if (inputBuffer.toFloat() == 0.0 && inputBuffer != "0" && inputBuffer != "0.0")
-        {
-            Serial.println("❌ 오류: 유효한 숫자를 입력하세요 (예: 25.5)");
-            Serial.print("상한 임계값 입력 (현재: ");
-            Serial.print(tempUpperThreshold, 1);
-            Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-            return;
-        }
 
-        // 범위 검증
-        if (!sensorController.isValidTemperature(newUpper))
-        {
-            Serial.println("❌ 경고: DS18B20 범위를 벗어났습니다 (-55~125°C)");
-            Serial.print("상한 임계값 입력 (현재: ");
-            Serial.print(tempUpperThreshold, 1);
-            Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-            return;
-        }
+    // 숫자 검증
+    float newUpper = TextParse::toFloat(inputBuffer.view());
+    if (newUpper == 0.0 && inputBuffer != "0" && inputBuffer != "0.0")
+    {
+        serialOut.println(ui(UiText::ERR_NUMBER_UPPER));
+        serialOut.print(ui(UiText::PROMPT_UPPER));
+        printCelsius(tempUpperThreshold);
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_RANGE));
+        return false;
+    }
 
-        tempUpperThreshold = newUpper;
-        Serial.print("상한값 설정: ");
-        Serial.print(tempUpperThreshold, 1);
-        Serial.println("°C");
+    // 범위 검증
+    if (!sensorController.isValidTemperature(newUpper))
+    {
+        serialOut.println(ui(UiText::WARN_DS18B20_RANGE));
+        serialOut.print(ui(UiText::PROMPT_UPPER));
+        printCelsius(tempUpperThreshold);
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_RANGE));
+        return false;
     }
 
-    // 하한값 입력으로 이동
-    appState = AppState::ThresholdChange_InputLower;
-    Serial.println("[DEBUG] appState -> ThresholdChange_InputLower");
-    Serial.print("새로운 하한 임계값 입력 (현재: ");
-    Serial.print(tempLowerThreshold, 1);
-    Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
+    tempUpperThreshold = newUpper;
+    serialOut.print(ui(UiText::UPPER_SET));
+    printCelsius(tempUpperThreshold);
+    serialOut.println("°C");
+    return true;
 }
 
-void MenuController::handleThresholdInputLowerState()
+// 하한값 입력 검증 (단일/복수 공통). 상한값보다 작아야 통과
+bool MenuController::inputLowerThreshold()
 {
-    if (inputBuffer == "c" || inputBuffer == "C")
-    {
-        appState = AppState::ThresholdMenu;
-        Serial.println("[DEBUG] appState -> ThresholdMenu");
-        printThresholdMenu();
-        return;
-    }
-
     // 빈 입력 (엔터만) - 기존값 유지
     if (inputBuffer.length() == 0)
     {
-        Serial.print("하한값 유지: ");
-        Serial.print(tempLowerThreshold, 1);
-        Serial.println("°C");
+        serialOut.print(ui(UiText::LOWER_KEPT));
+        printCelsius(tempLowerThreshold);
+        serialOut.println("°C");
     }
     else
     {
         // 숫자 검증
-        float newLower = inputBuffer.toFloat();
-        if (inputBuffer.toFloat() == 0.0 && inputBuffer != "0" && inputBuffer != "0.0")
+        float newLower = TextParse::toFloat(inputBuffer.view());
+        if (newLower == 0.0 && inputBuffer != "0" && inputBuffer != "0.0")
         {
-            Serial.println("❌ 오류: 유효한 숫자를 입력하세요 (예: 15.5)");
-            Serial.print("하한 임계값 입력 (현재: ");
-            Serial.print(tempLowerThreshold, 1);
-            Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-            return;
+            serialOut.println(ui(UiText::ERR_NUMBER_LOWER));
+            serialOut.print(ui(UiText::PROMPT_LOWER));
+            printCelsius(tempLowerThreshold);
+            serialOut.print(ui(UiText::PROMPT_THRESHOLD_RANGE));
+            return false;
         }
 
         // 범위 검증
         if (!sensorController.isValidTemperature(newLower))
         {
-            Serial.println("❌ 경고: DS18B20 범위를 벗어났습니다 (-55~125°C)");
-            Serial.print("하한 임계값 입력 (현재: ");
-            Serial.print(tempLowerThreshold, 1);
-            Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-            return;
+            serialOut.println(ui(UiText::WARN_DS18B20_RANGE));
+            serialOut.print(ui(UiText::PROMPT_LOWER));
+            printCelsius(tempLowerThreshold);
+            serialOut.print(ui(UiText::PROMPT_THRESHOLD_RANGE));
+            return false;
         }
 
         tempLowerThreshold = newLower;
-        Serial.print("하한값 설정: ");
-        Serial.print(tempLowerThreshold, 1);
-        Serial.println("°C");
+        serialOut.print(ui(UiText::LOWER_SET));
+        printCelsius(tempLowerThreshold);
+        serialOut.println("°C");
     }
 
     // 논리 검증: 상한값이 하한값보다 커야 함
     if (tempUpperThreshold <= tempLowerThreshold)
     {
-        Serial.println("❌ 경고: 상한값은 하한값보다 커야 합니다");
-        Serial.print("상한: ");
-        Serial.print(tempUpperThreshold, 1);
-        Serial.print("°C, 하한: ");
-        Serial.print(tempLowerThreshold, 1);
-        Serial.println("°C");
-        Serial.print("하한 임계값을 다시 입력하세요 (현재: ");
-        Serial.print(tempLowerThreshold, 1);
-        Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-        return;
+        serialOut.println(ui(UiText::WARN_UPPER_NOT_ABOVE_LOWER));
+        serialOut.print(ui(UiText::LABEL_UPPER));
+        printCelsius(tempUpperThreshold);
+        serialOut.print(ui(UiText::LABEL_LOWER_NEXT));
+        printCelsius(tempLowerThreshold);
+        serialOut.println("°C");
+        serialOut.print(ui(UiText::PROMPT_LOWER_AGAIN));
+        printCelsius(tempLowerThreshold);
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_RANGE));
+        return false;
     }
+    return true;
+}
+
+bool MenuController::applyThreshold()
+{
+    if (!inputLowerThreshold())
+        return false;
 
     // 임계값 설정 완료
-    sensorController.setThresholds(selectedSensorIdx, tempUpperThreshold, tempLowerThreshold);
+    sensorController.setThresholds(selectedSensorRom, tempUpperThreshold, tempLowerThreshold);
 
     // 결과 확인을 위해 센서 상태 테이블 출력
-    Serial.println();
+    serialOut.println();
     sensorController.printSensorStatusTable();
-
-    // 임계값 메뉴로 복귀
-    appState = AppState::ThresholdMenu;
-    Serial.println("[DEBUG] appState -> ThresholdMenu");
-    printThresholdMenu();
+    return true;
 }
 
 // ========== 복수 센서 임계값 설정 메서드들 ==========
 
-void MenuController::handleThresholdSelectMultipleSensorsState()
+bool MenuController::selectThresholdSensors()
 {
-    if (inputBuffer == "c" || inputBuffer == "C")
-    {
-        appState = AppState::ThresholdMenu;
-        Serial.println("[DEBUG] appState -> ThresholdMenu");
-        printThresholdMenu();
-        return;
-    }
-
     // 센서 번호 파싱 및 검증
     if (!validateSensorInput())
     {
-        Serial.print("임계값을 설정할 센서 번호들을 입력하세요 (예: 1 2 3 5, 취소:c): ");
-        return;
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_SENSORS));
+        return false;
     }
 
-    std::vector<int> indices = parseSensorIndices(inputBuffer);
+    SensorIndexList indices = parseSensorIndices(inputBuffer.view());
     if (!processSensorIndices(indices))
     {
-        Serial.print("임계값을 설정할 센서 번호들을 입력하세요 (예: 1 2 3 5, 취소:c): ");
-        return;
+        serialOut.print(ui(UiText::PROMPT_THRESHOLD_SENSORS));
+        return false;
     }
 
     // 선택된 센서들 확인
     selectedSensorIndices = indices;
-    appState = AppState::ThresholdChange_ConfirmMultipleSensors;
-    Serial.println("[DEBUG] appState -> ThresholdChange_ConfirmMultipleSensors");
 
-    Serial.println();
-    Serial.print("선택된 센서: ");
+    serialOut.println();
+    serialOut.print(ui(UiText::SELECTED_SENSORS));
     for (size_t i = 0; i < selectedSensorIndices.size(); i++)
     {
-        Serial.print(selectedSensorIndices[i]);
+        serialOut.print(selectedSensorIndices[i]);
         if (i < selectedSensorIndices.size() - 1)
         {
-            Serial.print(", ");
+            serialOut.print(", ");
         }
     }
-    Serial.println();
-    Serial.print("이 센서들에 동일한 임계값을 설정하시겠습니까? (y/n, 취소:c): ");
-}
-
-void MenuController::handleThresholdConfirmMultipleSensorsState()
-{
-    if (inputBuffer == "c" || inputBuffer == "C")
-    {
-        appState = AppState::ThresholdMenu;
-        Serial.println("[DEBUG] appState -> ThresholdMenu");
-        printThresholdMenu();
-        return;
-    }
-
-    if (inputBuffer == "y" || inputBuffer == "Y")
-    {
-        // 기본값으로 임시 임계값 설정 (첫 번째 센서의 현재값 사용)
-        int firstSensorIdx = selectedSensorIndices[0] - 1;
-        tempUpperThreshold = sensorController.getUpperThreshold(firstSensorIdx);
-        tempLowerThreshold = sensorController.getLowerThreshold(firstSensorIdx);
-
-        appState = AppState::ThresholdChange_InputMultipleUpper;
-        Serial.println("[DEBUG] appState -> ThresholdChange_InputMultipleUpper");
-
-        Serial.println();
-        Serial.print("📊 복수 센서 임계값 설정 (");
-        Serial.print(selectedSensorIndices.size());
-        Serial.println("개 센서)");
-        Serial.print("새로운 상한 임계값 입력 (현재: ");
-        Serial.print(tempUpperThreshold, 1);
-        Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-    }
-    else if (inputBuffer == "n" || inputBuffer == "N")
-    {
-        appState = AppState::ThresholdChange_SelectMultipleSensors;
-        Serial.println("[DEBUG] appState -> ThresholdChange_SelectMultipleSensors");
-        Serial.print("임계값을 설정할 센서 번호들을 입력하세요 (예: 1 2 3 5, 취소:c): ");
-    }
-    else
-    {
-        Serial.println("y(예), n(아니오), c(취소) 중 하나를 입력하세요.");
-        Serial.print("이 센서들에 동일한 임계값을 설정하시겠습니까? (y/n, 취소:c): ");
-    }
+    serialOut.println();
+    return true;
 }
 
-void MenuController::handleThresholdInputMultipleUpperState()
+bool MenuController::beginMultipleThresholds()
 {
-    if (inputBuffer == "c" || inputBuffer == "C")
-    {
-        appState = AppState::ThresholdMenu;
-        Serial.println("[DEBUG] appState -> ThresholdMenu");
-        printThresholdMenu();
-        return;
-    }
-
-    // 빈 입력 (엔터만) - 기존값 유지
-    if (inputBuffer.length() == 0)
-    {
-        Serial.print("상한값 유지: ");
-        Serial.print(tempUpperThreshold, 1);
-        Serial.println("°C");
-    }
-    else
-    {
-        // 숫자 검증
-        float newUpper = inputBuffer.toFloat();
-        if (inputBuffer.toFloat() == 0.0 && inputBuffer != "0" && inputBuffer != "0.0")
-        {
-            Serial.println("❌ 오류: 유효한 숫자를 입력하세요 (예: 25.5)");
-            Serial.print("상한 임계값 입력 (현재: ");
-            Serial.print(tempUpperThreshold, 1);
-            Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-            return;
-        }
-
-        // 범위 검증
-        if (!sensorController.isValidTemperature(newUpper))
-        {
-            Serial.println("❌ 경고: DS18B20 범위를 벗어났습니다 (-55~125°C)");
-            Serial.print("상한 임계값 입력 (현재: ");
-            Serial.print(tempUpperThreshold, 1);
-            Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-            return;
-        }
-
-        tempUpperThreshold = newUpper;
-        Serial.print("상한값 설정: ");
-        Serial.print(tempUpperThreshold, 1);
-        Serial.println("°C");
-    }
-
-    // 하한값 입력으로 이동
-    appState = AppState::ThresholdChange_InputMultipleLower;
-    Serial.println("[DEBUG] appState -> ThresholdChange_InputMultipleLower");
-    Serial.print("새로운 하한 임계값 입력 (현재: ");
-    Serial.print(tempLowerThreshold, 1);
-    Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
+    // 기본값으로 임시 임계값 설정 (첫 번째 센서의 현재값 사용)
+    uint64_t firstRom = 0;
+    sensorController.getDisplayRowRom(selectedSensorIndices[0], firstRom);
+    tempUpperThreshold = sensorController.getUpperThreshold(firstRom);
+    tempLowerThreshold = sensorController.getLowerThreshold(firstRom);
+
+    serialOut.println();
+    serialOut.print(ui(UiText::MULTI_THRESHOLD_HEADER));
+    serialOut.print(selectedSensorIndices.size());
+    serialOut.println(ui(UiText::MULTI_THRESHOLD_HEADER_END));
+    return true;
 }
 
-void MenuController::handleThresholdInputMultipleLowerState()
+bool MenuController::applyMultipleThresholds()
 {
-    if (inputBuffer == "c" || inputBuffer == "C")
-    {
-        appState = AppState::ThresholdMenu;
-        Serial.println("[DEBUG] appState -> ThresholdMenu");
-        printThresholdMenu();
-        return;
-    }
-
-    // 빈 입력 (엔터만) - 기존값 유지
-    if (inputBuffer.length() == 0)
-    {
-        Serial.print("하한값 유지: ");
-        Serial.print(tempLowerThreshold, 1);
-        Serial.println("°C");
-    }
-    else
-    {
-        // 숫자 검증
-        float newLower = inputBuffer.toFloat();
-        if (inputBuffer.toFloat() == 0.0 && inputBuffer != "0" && inputBuffer != "0.0")
-        {
-            Serial.println("❌ 오류: 유효한 숫자를 입력하세요 (예: 15.5)");
-            Serial.print("하한 임계값 입력 (현재: ");
-            Serial.print(tempLowerThreshold, 1);
-            Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-            return;
-        }
-
-        // 범위 검증
-        if (!sensorController.isValidTemperature(newLower))
-        {
-            Serial.println("❌ 경고: DS18B20 범위를 벗어났습니다 (-55~125°C)");
-            Serial.print("하한 임계값 입력 (현재: ");
-            Serial.print(tempLowerThreshold, 1);
-            Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-            return;
-        }
-
-        tempLowerThreshold = newLower;
-        Serial.print("하한값 설정: ");
-        Serial.print(tempLowerThreshold, 1);
-        Serial.println("°C");
-    }
-
-    // 논리 검증: 상한값이 하한값보다 커야 함
-    if (tempUpperThreshold <= tempLowerThreshold)
-    {
-        Serial.println("❌ 경고: 상한값은 하한값보다 커야 합니다");
-        Serial.print("상한: ");
-        Serial.print(tempUpperThreshold, 1);
-        Serial.print("°C, 하한: ");
-        Serial.print(tempLowerThreshold, 1);
-        Serial.println("°C");
-        Serial.print("하한 임계값을 다시 입력하세요 (현재: ");
-        Serial.print(tempLowerThreshold, 1);
-        Serial.print("°C, 범위: -55~125°C, 엔터=유지): ");
-        return;
-    }
+    if (!inputLowerThreshold())
+        return false;
 
     // 선택된 모든 센서에 임계값 설정
-    Serial.println();
-    Serial.println("🔄 복수 센서 임계값 설정 중...");
+    serialOut.println();
+    serialOut.println(ui(UiText::MULTI_THRESHOLD_APPLYING));
 
+    // 모든 센서 변경을 RAM에서 모은 뒤 한 번에 커밋
+    sensorController.beginConfigTransaction();
     for (int sensorNum : selectedSensorIndices)
     {
-        int sensorIdx = sensorNum - 1; // 0-based 인덱스로 변환
-        sensorController.setThresholds(sensorIdx, tempUpperThreshold, tempLowerThreshold);
+        uint64_t rom;
+        if (!sensorController.getDisplayRowRom(sensorNum, rom))
+        {
+            serialOut.print(ui(UiText::WARN_SENSOR_PREFIX));
+            serialOut.print(sensorNum);
+            serialOut.println(ui(UiText::SKIP_EMPTY_ROW));
+            continue;
+        }
+        sensorController.setThresholds(rom, tempUpperThreshold, tempLowerThreshold);
     }
+    sensorController.commitConfigTransaction();
 
-    Serial.println();
-    Serial.print("✅ ");
-    Serial.print(selectedSensorIndices.size());
-    Serial.print("개 센서 임계값 설정 완료: TH=");
-    Serial.print(tempUpperThreshold, 1);
-    Serial.print("°C, TL=");
-    Serial.print(tempLowerThreshold, 1);
-    Serial.println("°C");
+    serialOut.println();
+    serialOut.print("✅ ");
+    serialOut.print(selectedSensorIndices.size());
+    serialOut.print(ui(UiText::MULTI_THRESHOLD_DONE));
+    printCelsius(tempUpperThreshold);
+    serialOut.print("°C, TL=");
+    printCelsius(tempLowerThreshold);
+    serialOut.println("°C");
 
-    Serial.print("설정된 센서: ");
+    serialOut.print(ui(UiText::SENSORS_APPLIED));
     for (size_t i = 0; i < selectedSensorIndices.size(); i++)
     {
-        Serial.print(selectedSensorIndices[i]);
+        serialOut.print(selectedSensorIndices[i]);
         if (i < selectedSensorIndices.size() - 1)
         {
-            Serial.print(", ");
+            serialOut.print(", ");
         }
     }
-    Serial.println();
+    serialOut.println();
 
     // 결과 확인을 위해 센서 상태 테이블 출력
-    Serial.println();
+    serialOut.println();
     sensorController.printSensorStatusTable();
-
-    // 임계값 메뉴로 복귀
-    appState = AppState::ThresholdMenu;
-    Serial.println("[DEBUG] appState -> ThresholdMenu");
-    printThresholdMenu();
+    return true;
 }
 
 // ========== Measurement Interval Menu Methods ==========
 
 void MenuController::printMeasurementIntervalMenu()
 {
-    Serial.println();
-    Serial.println("===== 센서 측정 주기 조정 메뉴 =====");
-    Serial.print("현재 측정 주기: ");
-    Serial.println(sensorController.formatInterval(sensorController.getMeasurementInterval()));
-    Serial.println();
-    Serial.println("설정 가능 범위: 10초 ~ 30일 (1초 단위)");
-    Serial.println("입력 형식 예시:");
-    Serial.println("  - 초 단위: 30, 30s (30초)");
-    Serial.println("  - 분 단위: 5m, 5M (5분)");
-    Serial.println("  - 시간 단위: 2h, 2H (2시간)");
-    Serial.println("  - 일 단위: 1d, 1D (1일)");
-    Serial.println("  - 복합 단위: 1d2h30m (1일 2시간 30분)");
-    Serial.println("  - 복합 단위: 2h30m45s (2시간 30분 45초)");
-    Serial.println("※ 대소문자 구분 없음");
-    Serial.println();
-    Serial.print("새로운 측정 주기를 입력하세요 (취소:c): ");
+    serialOut.println();
+    serialOut.println(ui(UiText::INTERVAL_MENU_TITLE));
+    serialOut.print(ui(UiText::CURRENT_INTERVAL));
+    printIntervalLine(sensorController.getMeasurementInterval());
+    serialOut.println();
+    serialOut.println(ui(UiText::INTERVAL_RANGE));
+    serialOut.println(ui(UiText::INTERVAL_EXAMPLES_TITLE));
+    serialOut.println(ui(UiText::INTERVAL_EXAMPLE_SECONDS));
+    serialOut.println(ui(UiText::INTERVAL_EXAMPLE_MINUTES));
+    serialOut.println(ui(UiText::INTERVAL_EXAMPLE_HOURS));
+    serialOut.println(ui(UiText::INTERVAL_EXAMPLE_DAYS));
+    serialOut.println(ui(UiText::INTERVAL_EXAMPLE_MIXED_DAYS));
+    serialOut.println(ui(UiText::INTERVAL_EXAMPLE_MIXED_HOURS));
+    serialOut.println(ui(UiText::INTERVAL_CASE_NOTE));
+    serialOut.println();
+    serialOut.print(ui(UiText::PROMPT_INTERVAL));
 }
 
-void MenuController::handleMeasurementIntervalMenuState()
+bool MenuController::applyMeasurementInterval()
 {
-    appState = AppState::MeasurementInterval_Input;
-    Serial.println("[DEBUG] appState -> MeasurementInterval_Input");
-}
-
-void MenuController::handleMeasurementIntervalInputState()
-{
-    if (inputBuffer == "c" || inputBuffer == "C")
-    {
-        appState = AppState::Menu;
-        Serial.println("[DEBUG] appState -> Menu");
-        printMenu();
-        return;
-    }
-
     // 입력값 파싱
-    unsigned long intervalMs = parseIntervalInput(inputBuffer);
+    unsigned long intervalMs = TextParse::parseIntervalMs(inputBuffer.view());
 
     if (intervalMs == 0)
     {
-        Serial.println("❌ 오류: 유효하지 않은 입력 형식입니다.");
-        Serial.println("예시: 30 (30초), 5m (5분), 2h (2시간), 1d (1일)");
-        Serial.println("복합: 1d2h30m (1일 2시간 30분), 2h30m45s (2시간 30분 45초)");
-        Serial.print("새로운 측정 주기를 입력하세요 (취소:c): ");
-        return;
+        serialOut.println(ui(UiText::ERR_INTERVAL_FORMAT));
+        serialOut.println(ui(UiText::INTERVAL_HINT_SIMPLE));
+        serialOut.println(ui(UiText::INTERVAL_HINT_MIXED));
+        serialOut.print(ui(UiText::PROMPT_INTERVAL));
+        return false;
     }
 
     if (!sensorController.isValidMeasurementInterval(intervalMs))
     {
-        Serial.println("❌ 오류: 측정 주기 범위를 벗어났습니다 (10초 ~ 30일)");
-        Serial.print("새로운 측정 주기를 입력하세요 (취소:c): ");
-        return;
+        serialOut.println(ui(UiText::ERR_INTERVAL_RANGE_MENU));
+        serialOut.print(ui(UiText::PROMPT_INTERVAL));
+        return false;
     }
 
     // 측정 주기 설정
     sensorController.setMeasurementInterval(intervalMs);
 
-    Serial.println();
-    Serial.println("📊 측정 주기 변경 사항:");
-    Serial.print("  새로운 주기: ");
-    Serial.println(sensorController.formatInterval(intervalMs));
-    Serial.println("  다음 센서 상태 업데이트부터 새로운 주기가 적용됩니다.");
-
-    // 메인 메뉴로 복귀
-    appState = AppState::Menu;
-    Serial.println("[DEBUG] appState -> Menu");
-    printMenu();
+    serialOut.println();
+    serialOut.println(ui(UiText::INTERVAL_CHANGE_TITLE));
+    serialOut.print(ui(UiText::INTERVAL_NEW));
+    printIntervalLine(intervalMs);
+    serialOut.println(ui(UiText::INTERVAL_APPLIES_NEXT));
+    return true;
 }
-
-unsigned long MenuController::parseIntervalInput(const String &input)
-{
-    String trimmedInput = input;
-    trimmedInput.trim();
-    trimmedInput.toLowerCase(); // 대소문자 구분 없이 처리
-
-    if (trimmedInput.length() == 0)
-    {
-        return 0; // 빈 입력
-    }
-
-    // 복합 단위 지원 (예: "1d2h30m", "2h30m", "30m45s")
-    unsigned long totalMs = 0;
-    String currentNumber = "";
-
-    for (int i = 0; i < trimmedInput.length(); i++)
-    {
-        char c = trimmedInput.charAt(i);
-
-        if (isDigit(c))
-        {
-            currentNumber += c;
-        }
-        else if (c == 'd' || c == 'h' || c == 'm' || c == 's')
-        {
-            if (currentNumber.length() == 0)
-            {
-                return 0; // 숫자 없이 단위만 있음
-            }
-
-            long number = currentNumber.toInt();
-            if (number <= 0)
-            {
-                return 0; // 유효하지 않은 숫자
-            }
-
-            unsigned long multiplier = 1000; // 기본값: 초
-            if (c == 'd')
-            {
-                multiplier = 24 * 60 * 60 * 1000; // 일
-            }
-            else if (c == 'h')
-            {
-                multiplier = 60 * 60 * 1000; // 시간
-            }
-            else if (c == 'm')
-            {
-                multiplier = 60 * 1000; // 분
-            }
-            else if (c == 's')
-            {
-                multiplier = 1000; // 초
-            }
-
-            // 오버플로우 체크
-            if (number > (MAX_MEASUREMENT_INTERVAL / multiplier))
-            {
-                return 0; // 너무 큰 값
-            }
-
-            unsigned long partMs = (unsigned long)number * multiplier;
-
-            // 총합 오버플로우 체크
-            if (totalMs > MAX_MEASUREMENT_INTERVAL - partMs)
-            {
-                return 0; // 총합이 너무 큼
-            }
-
-            totalMs += partMs;
-            currentNumber = "";
-        }
-        else
-        {
-            return 0; // 유효하지 않은 문자
-        }
-    }
-
-    // 마지막에 숫자만 있고 단위가 없는 경우 (초로 처리)
-    if (currentNumber.length() > 0)
-    {
-        long number = currentNumber.toInt();
-        if (number <= 0)
-        {
-            return 0; // 유효하지 않은 숫자
-        }
-
-        // 오버플로우 체크
-        if (number > (MAX_MEASUREMENT_INTERVAL / 1000))
-        {
-            return 0; // 너무 큰 값
-        }
-
-        unsigned long partMs = (unsigned long)number * 1000; // 초
-
-        // 총합 오버플로우 체크
-        if (totalMs > MAX_MEASUREMENT_INTERVAL - partMs)
-        {
-            return 0; // 총합이 너무 큼
-        }
-
-        totalMs += partMs;
-    }
-
-    // 최소값 체크
-    if (totalMs < MIN_MEASUREMENT_INTERVAL)
-    {
-        return 0; // 너무 작은 값
-    }
-
-    return totalMs;
-}
\ No newline at end of file
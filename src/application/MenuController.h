@@ -1,10 +1,15 @@
 #pragma once
 #include <Arduino.h>
-#include <vector>
+#include <string_view>
 #include "InputHandler.h"
 #include "SensorMenuHandler.h"
 
-enum class AppState
+// 시리얼 통신 속도 (기본값은 부팅 시 사용, 변경은 'baud' 명령으로 협상)
+constexpr unsigned long SERIAL_DEFAULT_BAUD = 115200;
+constexpr unsigned long SERIAL_SUPPORTED_BAUDS[] = {115200, 230400, 460800, 921600, 1000000, 2000000};
+constexpr unsigned long BAUD_CONFIRM_TIMEOUT_MS = 3000;
+
+enum class AppState : uint8_t
 {
     Normal,
     Menu,
@@ -25,20 +30,72 @@ enum class AppState
     ThresholdChange_InputMultipleLower,
     MeasurementIntervalMenu,
     MeasurementInterval_Input,
+    COUNT, // 상태 수 (전이 표 크기, 실제 상태 아님)
+};
+
+// 메뉴 입력 한 줄의 분류 (전이 표의 열)
+enum class MenuInput : uint8_t
+{
+    Choice1, // "1" ~ "6": 메뉴 항목 번호
+    Choice2,
+    Choice3,
+    Choice4,
+    Choice5,
+    Choice6,
+    Yes,      // y/Y
+    No,       // n/N
+    Cancel,   // c/C
+    MenuWord, // menu/MENU/m/M
+    Other,    // 그 밖의 입력, 해당 열 행이 없는 상태에서도 이 행을 사용
+    COUNT,
+};
+
+// 전이 후 출력할 화면·안내문 (전이 표의 화면 열)
+enum class MenuPrompt : uint8_t
+{
+    None,
+    MainMenu,
+    SensorIdMenu,
+    ThresholdMenu,
+    IntervalMenu,
+    StatusTable,            // 정상 출력 복귀: 상태 테이블 출력 후 주기 출력 기준 시각 갱신
+    IdSelectSensor,         // 제목 + 상태 테이블 + 센서 선택 안내 (단일/복수)
+    IdSelectSensorAgain,    // 센서 선택 안내만
+    IdConfirmSensor,        // "센서 N ... 변경할까요?" (줄바꿈)
+    IdConfirmSensorAgain,   // 같은 안내, 잘못된 입력 후 (줄바꿈 없음)
+    IdNewId,                // 새 ID 입력 안내
+    ResetIdsConfirm,        // 전체 ID 초기화 경고 + 계속 여부
+    ResetIdsAgain,          // 초기화 확인 안내만
+    ThresholdSelectSensor,  // 임계값 현황 + 센서 번호 입력 안내
+    ThresholdSelectSensors, // 복수 임계값 제목 + 상태 테이블 + 센서 번호 입력 안내
+    ThresholdSensorsAgain,  // 복수 센서 번호 입력 안내만
+    SameThresholds,         // 같은 임계값 적용 확인 안내
+    NewUpper,               // 새 상한값 입력 안내
+    NewLower,               // 새 하한값 입력 안내
 };
 
 class MenuController
 {
 public:
     // 복수 센서 인덱스 파싱 함수
-    static std::vector<int> parseSensorIndices(const String &input);
+    static SensorIndexList parseSensorIndices(std::string_view input);
     MenuController();
 
     void printMenu();
     void printSensorIdMenu();
     void printThresholdMenu();
     void printMeasurementIntervalMenu();
-    void handleSerialInput();
+    void printBootTiming(); // 'boot' 명령: 부팅 단계별 시간
+    void printRenderStats(); // 'perf' 명령: 상태 테이블 출력 비용
+    void printMemoryStats(); // 'mem' 명령: loop() 작업 영역 사용량, malloc 호출 횟수
+    void handleOutputModeCommand(); // 'mode' 명령: 주기 출력 형식 조회/변경
+    void handleBaudCommand(); // 'baud' 명령: 통신 속도 변경 (호스트 확인 없으면 복귀)
+    void handleDeltaCommand(); // 'delta' 명령: 변경분 출력 설정
+    void handleTxQueueCommand(); // 'txq' 명령: 송신 큐 통계/넘침 정책
+    void handleTraceCommand(); // 'trace' 명령: 추적 로그 링 덤프/비우기
+    void handleCrashLogCommand(); // 'crashlog' 명령: 리셋 후에도 남는 로그 조회/비우기
+    void handleInputLine(const char *line); // 수신한 한 줄 중 설정 명령이 아닌 줄 (CommandManagerService가 전달)
+    void update(); // loop()마다 호출: 통신 속도 변경 확인 시간 초과 처리
 
     AppState getAppState() const { return appState; }
     void setAppState(AppState state) { appState = state; }
@@ -49,70 +106,75 @@ public:
 
 private:
     // 복수 센서 선택용 멤버 변수
-    std::vector<int> selectedSensorIndices;
+    SensorIndexList selectedSensorIndices;
     AppState appState;
-    String inputBuffer;
+    InputLine inputBuffer;
     int selectedSensorIdx;
     int selectedDisplayIdx;
+    uint64_t selectedSensorRom; // 임계값 설정 대상 센서 ROM 주소
     bool isMultiSelectMode = false;
+
+    // 통신 속도 협상 상태 (확인 전까지 이전 속도로 복귀 가능)
+    unsigned long activeBaud;
+    unsigned long fallbackBaud;
+    unsigned long baudConfirmDeadline; // 0: 확인 대기 없음
     
     // 헬퍼 클래스들
-    InputHandler inputHandler;
     SensorMenuHandler sensorMenuHandler;
     
     // 임계값 설정용 임시 변수들
     float tempUpperThreshold;
     float tempLowerThreshold;
 
-    void handleNormalState();
-    void handleMenuState();
-    void handleSensorIdMenuState();
-    void handleSensorIdSelectState();
-    void handleSensorIdConfirmState();
-    void handleSensorIdInputState();
-    void handleSensorIdConfirmResetState();
-    
-    // 임계값 설정 관련 메서드
-    void handleThresholdMenuState();
-    void handleThresholdSelectSensorState();
-    void handleThresholdInputUpperState();
-    void handleThresholdInputLowerState();
-    
-    // 복수 센서 임계값 설정 관련 메서드
-    void handleThresholdSelectMultipleSensorsState();
-    void handleThresholdConfirmMultipleSensorsState();
-    void handleThresholdInputMultipleUpperState();
-    void handleThresholdInputMultipleLowerState();
-    
-    // 측정 주기 설정 관련 메서드
-    void handleMeasurementIntervalMenuState();
-    void handleMeasurementIntervalInputState();
-    
-    // 측정 주기 입력 파싱 헬퍼 메서드
-    unsigned long parseIntervalInput(const String& input);
-    
-    // Helper methods for handleSensorIdSelectState
+    // 메뉴 전이 표 (행 정의와 색인은 MenuController.cpp)
+    struct Transition;
+    struct DispatchIndex;
+    static const Transition TRANSITIONS[];
+    static const DispatchIndex DISPATCH;
+
+    MenuInput classifyInput() const;
+    void enterState(AppState next, MenuPrompt prompt);
+    void showPrompt(MenuPrompt prompt);
+
+    // 전이 표 처리 함수: false를 반환하면 (입력 오류, 안내는 이미 출력) 상태 유지
+    bool handleNormalState();
+
+    // 센서 ID 변경
+    bool beginSingleIdChange();
+    bool beginMultiIdChange();
+    bool assignIdsByAddress();
+    bool selectIdChangeSensors();
+    bool handleConfirmNoOrCancel();
+    bool handleCancelInput();
+    bool inputNewSensorId();
+    bool resetAllIds();
+
+    // 임계값 설정 (단일/복수 공통 상한값 입력 포함)
+    bool resetAllThresholds();
+    bool selectThresholdSensor();
+    bool inputUpperThreshold();
+    bool applyThreshold();
+    bool selectThresholdSensors();
+    bool beginMultipleThresholds();
+    bool applyMultipleThresholds();
+
+    // 측정 주기 설정
+    bool applyMeasurementInterval();
+
+    // 처리 함수 보조
     bool validateSensorInput();
-    bool processSensorIndices(const std::vector<int>& indices);
-    void proceedToSensorConfirmation();
+    bool processSensorIndices(const SensorIndexList& indices);
     void printSensorSelectionPrompt();
-    
-    // Helper methods for handleSensorIdInputState
-    void handleCancelInput();
+    bool inputLowerThreshold();
     bool processNewSensorId(int newId);
     void moveToNextSensor();
     void completeIdChange();
     void printIdInputPrompt();
     
-    // Helper methods for handleSensorIdConfirmState
-    void handleConfirmYes();
-    void handleConfirmNoOrCancel();
-    void handleInvalidConfirmInput();
-    void moveToNextSensorInConfirm();
-    
-    // Helper methods for handleSerialInput
+    // Helper methods for handleInputLine
     void processInputBuffer();
     bool handleGlobalResetCommand();
     void processStateBasedInput();
-    void clearInputBuffer();
+    void applyBaudRate(unsigned long baud);
+    void checkBaudConfirmTimeout();
 };
@@ -1,69 +1,397 @@
 #include <Arduino.h>
 #include <cstring>
 #include <cmath>
-#include <vector>
 #include <algorithm>
 #include "SensorController.h"
+#include "SensorStatusCode.h"
+#include "../domain/AnsiTerminal.h"
+#include "../domain/BumpArena.h"
+#include "../domain/Crc16.h"
+#include "../domain/Format.h"
+#include "../domain/StaticVector.h"
+#include "../domain/LogCatalog.h"
+#include "../domain/TelemetryProtocol.h"
+#include "../domain/UiText.h"
+#include "../infrastructure/CycleCounter.h"
+#include "../infrastructure/BinaryLogger.h"
 #include <OneWire.h>
 #include <DallasTemperature.h>
+#include <ArduinoJson.h>
 
 extern OneWire oneWire;
 extern DallasTemperature sensors;
+extern BinaryLogger systemLogger;
+extern BumpArena cycleArena;
+
+namespace
+{
+// ArduinoJson 문서 메모리를 loop() 작업 영역에서 받음 (해제는 cycleArena 되돌림으로 처리)
+struct CycleArenaAllocator
+{
+    void *allocate(size_t size) { return cycleArena.allocate(size); }
+    void deallocate(void *) {}
+    void *reallocate(void *, size_t) { return nullptr; }
+};
+
+// 행에 담을 논리 ID: 레코드가 없거나 범위(1~SENSOR_MAX_COUNT) 밖이면 0(미할당)
+uint8_t rowLogicalId(const SensorConfigRecord *record)
+{
+    if (!record || record->logicalId < 1 || record->logicalId > SENSOR_MAX_COUNT)
+        return 0;
+    return record->logicalId;
+}
+} // namespace
 
 SensorRowInfo SensorController::g_sortedSensorRows[SENSOR_MAX_COUNT];
 
-SensorController::SensorController()
+// 리셋 시 초기화되지 않는 RAM 영역 (전원 인가 시에는 CRC 검사로 걸러짐)
+WarmStartCache SensorController::warmCache __attribute__((section(".noinit")));
+
+SensorController::SensorController(IConfigStore *store)
+    : configStore(store),
+      console(&Serial),
+      alarmConsole(&Serial),
+      sensorConfigs(store->config().sensorRecords, CONFIG_MAX_SENSOR_RECORDS),
+      busCount(0),
+      discoveredCount(0),
+      discoveryActive(false),
+      fastBootUsed(false),
+      firstReadingMs(0),
+      conversionPending(false),
+      conversionStartMs(0),
+      conversionResolution(DEFAULT_SENSOR_RESOLUTION),
+      warmTablePending(false),
+      csvHeaderPending(true),
+      telemetrySequence(0),
+      framesSinceRomMap(0),
+      romMapPending(true),
+      reportedStates(),
+      reportedCount(0),
+      rowReported(),
+      removedRoms(),
+      removedCount(0),
+      deltaFrame(false),
+      keyframePending(true),
+      reportsSinceKeyframe(0),
+      dashboardCells(),
+      dashboardRedrawPending(true),
+      dashboardUpdates(0),
+      renderStats()
 {
     // 생성자에서는 기본 초기화만 수행
-    // EEPROM 초기화는 setup()에서 명시적으로 호출
-    measurementInterval = DEFAULT_MEASUREMENT_INTERVAL;
+    // 설정 로드는 setup()에서 initializeThresholds()로 명시적으로 호출
 }
 
-uint8_t SensorController::getSensorLogicalId(int idx)
+void SensorController::beginSensors()
+{
+    // 1) 저장된 ROM 목록이 모두 응답하면 전체 검색 없이 바로 측정 시작
+    if (restoreKnownRoster())
+    {
+        fastBootUsed = true;
+        console->print(ui(UiText::ROSTER_RESTORED));
+        console->print(busCount);
+        console->println(ui(UiText::ROSTER_RESTORED_END));
+
+        // 구성 변경(추가/제거)은 loop()에서 단계별 검색으로 확인
+        oneWire.reset_search();
+        discoveredCount = 0;
+        discoveryActive = true;
+        return;
+    }
+
+    // 2) 저장된 목록이 없거나 일부가 응답하지 않으면 기존 방식의 전체 검색
+    sensors.begin();
+    DeviceAddress found[SENSOR_MAX_COUNT];
+    int count = 0;
+    int deviceCount = sensors.getDeviceCount();
+    for (int i = 0; i < deviceCount && count < SENSOR_MAX_COUNT; ++i)
+    {
+        if (sensors.getAddress(found[count], i))
+            count++;
+    }
+    applySensorRoster(found, count);
+    console->println(ui(UiText::DISCOVERY_DONE));
+}
+
+bool SensorController::restoreKnownRoster()
+{
+    const SystemConfig &cfg = configStore->config();
+    if (cfg.knownRomCount == 0 || cfg.knownRomCount > SENSOR_MAX_COUNT)
+        return false;
+
+    DeviceAddress found[SENSOR_MAX_COUNT];
+    int count = 0;
+    for (uint8_t i = 0; i < cfg.knownRomCount; ++i)
+    {
+        romToBytes(cfg.knownRoms[i], found[count]);
+
+        // MATCH ROM + 스크래치패드 CRC 확인 (장치당 수 ms)
+        if (!sensors.isConnected(found[count]))
+            return false;
+
+        // 기생 전원 센서는 라이브러리 전역 설정이 필요하므로 전체 초기화로 처리
+        if (sensors.readPowerSupply(found[count]))
+            return false;
+        count++;
+    }
+
+    applySensorRoster(found, count);
+    return true;
+}
+
+void SensorController::updateSensorDiscovery()
+{
+    if (!discoveryActive)
+        return;
+
+    // 한 번에 장치 하나씩만 검색하여 loop() 지연을 최소화
+    DeviceAddress addr;
+    if (oneWire.search(addr))
+    {
+        if (sensors.validAddress(addr) && sensors.validFamily(addr) && discoveredCount < SENSOR_MAX_COUNT)
+        {
+            memcpy(discoveredAddresses[discoveredCount], addr, sizeof(DeviceAddress));
+            discoveredCount++;
+        }
+        return;
+    }
+
+    discoveryActive = false;
+    if (!isRosterChanged(discoveredAddresses, discoveredCount))
+        return;
+
+    LOG_TRACE(&systemLogger, ROSTER_CHANGED, busCount, discoveredCount);
+    console->print(ui(UiText::ROSTER_CHANGED));
+    console->print(busCount);
+    console->print(ui(UiText::ROSTER_COUNT_ARROW));
+    console->print(discoveredCount);
+    console->println(ui(UiText::COUNT_SUFFIX));
+    applySensorRoster(discoveredAddresses, discoveredCount);
+}
+
+bool SensorController::isRosterChanged(const DeviceAddress *addrs, int count) const
+{
+    if (count != busCount)
+        return true;
+
+    for (int i = 0; i < count; ++i)
+    {
+        bool known = false;
+        for (int j = 0; j < busCount; ++j)
+        {
+            if (memcmp(addrs[i], busAddresses[j], sizeof(DeviceAddress)) == 0)
+            {
+                known = true;
+                break;
+            }
+        }
+        if (!known)
+            return true;
+    }
+    return false;
+}
+
+void SensorController::applySensorRoster(const DeviceAddress *addrs, int count)
 {
-    int id = sensors.getUserDataByIndex(idx);
-    if (id < 1 || id > SENSOR_MAX_COUNT)
+    busCount = 0;
+    for (int i = 0; i < count && busCount < SENSOR_MAX_COUNT; ++i)
+    {
+        memcpy(busAddresses[busCount], addrs[i], sizeof(DeviceAddress));
+        busCount++;
+    }
+
+    // 처음 보는 센서는 설정 레코드를 생성하고 분해능 적용
+    beginConfigTransaction();
+    for (int i = 0; i < busCount; ++i)
     {
-        return 0; // ID가 설정되지 않은 센서는 0 반환 (미할당 상태)
+        uint64_t rom = romFromBytes(busAddresses[i]);
+        bool isNew = (sensorConfigs.find(rom) == nullptr);
+        SensorConfigRecord *record = ensureSensorConfig(rom);
+        if (!record)
+            continue;
+
+        if (isNew)
+        {
+            adoptLegacySettings(*record, busAddresses[i]);
+            configStore->save();
+        }
+
+        if (record->resolution != DEFAULT_SENSOR_RESOLUTION)
+            sensors.setResolution(busAddresses[i], record->resolution, true);
     }
-    return id;
+    updateConversionResolution();
+
+    if (configStore->config().legacyRowThresholdsPending)
+        migrateLegacyRowThresholds();
+    saveKnownRoms();
+    configStore->commit();
+    romMapPending = true; // 슬롯 구성이 바뀌었을 수 있음
+}
+
+void SensorController::updateConversionResolution()
+{
+    // 센서별 분해능은 전역 재계산 없이 적용하므로 변환 대기 기준은 버스 센서 중 최대 분해능으로 직접 계산
+    uint8_t maxResolution = 9;
+    for (int i = 0; i < busCount; ++i)
+    {
+        const SensorConfigRecord *record = sensorConfigs.find(romFromBytes(busAddresses[i]));
+        uint8_t resolution = record ? record->resolution : DEFAULT_SENSOR_RESOLUTION;
+        if (resolution > maxResolution)
+            maxResolution = resolution;
+    }
+    conversionResolution = maxResolution;
+
+    // begin()을 생략한 빠른 부팅은 라이브러리 장치 수가 0이라 버스 쓰기 없이 전역 값만 갱신됨
+    // (장치 수가 있으면 setResolution(bits)가 모든 센서의 분해능을 덮어쓰므로 호출하지 않음)
+    if (sensors.getDeviceCount() == 0)
+        sensors.setResolution(maxResolution);
+}
+
+void SensorController::saveKnownRoms()
+{
+    // 목록이 바뀐 경우에만 기록 (다음 부팅의 빠른 확인용)
+    SystemConfig &cfg = configStore->config();
+    bool changed = (cfg.knownRomCount != busCount);
+    for (int i = 0; i < busCount && !changed; ++i)
+    {
+        if (cfg.knownRoms[i] != romFromBytes(busAddresses[i]))
+            changed = true;
+    }
+    if (!changed)
+        return;
+
+    cfg.knownRomCount = static_cast<uint8_t>(busCount);
+    for (uint8_t i = 0; i < CONFIG_SENSOR_SLOTS; ++i)
+    {
+        cfg.knownRoms[i] = (i < busCount) ? romFromBytes(busAddresses[i]) : 0;
+    }
+    configStore->save();
+}
+
+uint64_t SensorController::getSensorRom(int idx) const
+{
+    if (idx < 0 || idx >= busCount)
+        return 0;
+    return romFromBytes(busAddresses[idx]);
+}
+
+bool SensorController::getDisplayRowRom(int displayNum, uint64_t &rom) const
+{
+    if (displayNum < 1 || displayNum > SENSOR_MAX_COUNT)
+        return false;
+
+    const SensorRowInfo &row = g_sortedSensorRows[displayNum - 1];
+    if (!row.connected)
+        return false;
+
+    rom = row.rom;
+    return true;
+}
+
+SensorConfigRecord *SensorController::ensureSensorConfig(uint64_t rom)
+{
+    SensorConfigRecord *record = sensorConfigs.insert(rom);
+    if (record)
+        return record;
+
+    // 레코드가 가득 찼으면 현재 버스에 없는 센서의 레코드를 하나 비움
+    for (uint8_t i = 0; i < sensorConfigs.capacity(); ++i)
+    {
+        uint64_t candidate = sensorConfigs.recordAt(i)->rom;
+        bool onBus = false;
+        for (int j = 0; j < busCount; ++j)
+        {
+            if (romFromBytes(busAddresses[j]) == candidate)
+            {
+                onBus = true;
+                break;
+            }
+        }
+        if (!onBus)
+        {
+            sensorConfigs.remove(candidate);
+            return sensorConfigs.insert(rom);
+        }
+    }
+    return nullptr;
+}
+
+void SensorController::adoptLegacySettings(SensorConfigRecord &record, const DeviceAddress &addr)
+{
+    // 이전 펌웨어는 논리 ID를 센서 스크래치패드(사용자 데이터)에 저장했음
+    int legacyId = sensors.getUserData(addr);
+    if (legacyId < 1 || legacyId > SENSOR_MAX_COUNT)
+        return;
+
+    for (int i = 0; i < busCount; ++i)
+    {
+        SensorConfigRecord *other = sensorConfigs.find(romFromBytes(busAddresses[i]));
+        if (other && other != &record && other->logicalId == legacyId)
+            return; // 중복 ID는 가져오지 않음
+    }
+    record.logicalId = static_cast<uint8_t>(legacyId);
+}
+
+void SensorController::migrateLegacyRowThresholds()
+{
+    // 이전 버전에서 보이던 표시 행 순서대로 행 기반 임계값을 각 센서 레코드로 이전
+    SystemConfig &cfg = configStore->config();
+    buildSensorRows();
+
+    for (int row = 0; row < SENSOR_MAX_COUNT; ++row)
+    {
+        const SensorRowInfo &info = g_sortedSensorRows[row];
+        if (!info.connected || !cfg.thresholds[row].isCustomSet)
+            continue;
+
+        SensorConfigRecord *record = sensorConfigs.find(info.rom);
+        if (!record || record->isCustomSet)
+            continue;
+
+        record->upperThreshold = cfg.thresholds[row].upperThreshold;
+        record->lowerThreshold = cfg.thresholds[row].lowerThreshold;
+        record->isCustomSet = 1;
+    }
+
+    cfg.legacyRowThresholdsPending = 0;
+    configStore->save();
+    console->println(ui(UiText::LEGACY_ROWS_MIGRATED));
+}
+
+uint8_t SensorController::getSensorLogicalId(int idx)
+{
+    // ID가 설정되지 않은 센서는 0 반환 (미할당 상태)
+    return rowLogicalId(sensorConfigs.find(getSensorRom(idx)));
 }
 
 void SensorController::setSensorLogicalId(int idx, uint8_t newId)
 {
+    SensorConfigRecord *record = ensureSensorConfig(getSensorRom(idx));
+    if (!record)
+    {
+        console->println(ui(UiText::ERR_CONFIG_NO_ROOM));
+        return;
+    }
+
     // EEPROM 수명 보호: 값이 변경된 경우에만 쓰기
-    uint8_t currentId = sensors.getUserDataByIndex(idx);
+    uint8_t currentId = record->logicalId;
 
     if (currentId != newId)
     {
-        sensors.setUserDataByIndex(idx, newId);
-        delay(30); // EEPROM write 여유 대기
+        record->logicalId = newId;
+        configStore->save();
 
-        int verify = sensors.getUserDataByIndex(idx);
-        Serial.print("[진단] setSensorLogicalId idx:");
-        Serial.print(idx);
-        Serial.print(" userData(변경: ");
-        Serial.print(currentId);
-        Serial.print(" → ");
-        Serial.print(verify);
-        Serial.print(", 기대값:");
-        Serial.print(newId);
-        Serial.println(")");
+        LOG_TRACE(&systemLogger, SENSOR_ID_SET, idx, currentId, newId);
     }
     else
     {
-        Serial.print("[진단] setSensorLogicalId idx:");
-        Serial.print(idx);
-        Serial.print(" userData 변경 없음 (현재값: ");
-        Serial.print(currentId);
-        Serial.println(")");
+        LOG_TRACE(&systemLogger, SENSOR_ID_UNCHANGED, idx, currentId);
     }
 }
 
 bool SensorController::isIdDuplicated(int newId, int exceptIdx)
 {
-    int deviceCount = sensors.getDeviceCount();
-    for (int i = 0; i < deviceCount; ++i)
+    for (int i = 0; i < busCount; ++i)
     {
         if (i == exceptIdx)
             continue;
@@ -75,40 +403,37 @@ bool SensorController::isIdDuplicated(int newId, int exceptIdx)
 
 void SensorController::assignIDsByAddress()
 {
-    int count = sensors.getDeviceCount();
-    std::vector<int> idxs;
-    idxs.reserve(count);
-    for (int i = 0; i < count; ++i)
+    StaticVector<int, SENSOR_MAX_COUNT> idxs;
+    for (int i = 0; i < busCount; ++i)
         idxs.push_back(i);
     std::sort(idxs.begin(), idxs.end(), [&](int a, int b)
-              {
-        DeviceAddress addrA, addrB;
-        sensors.getAddress(addrA, a);
-        sensors.getAddress(addrB, b);
-        return memcmp(addrA, addrB, sizeof(DeviceAddress)) < 0; });
+              { return memcmp(busAddresses[a], busAddresses[b], sizeof(DeviceAddress)) < 0; });
+    beginConfigTransaction();
     for (int j = 0; j < (int)idxs.size(); ++j)
     {
         setSensorLogicalId(idxs[j], j + 1);
     }
+    commitConfigTransaction();
 }
 
 void SensorController::resetAllSensorIds()
 {
-    int deviceCount = sensors.getDeviceCount();
-    Serial.println();
-    Serial.println("=== 전체 센서 ID 초기화 시작 ===");
+    int deviceCount = busCount;
+    console->println();
+    console->println(ui(UiText::RESET_IDS_TITLE));
 
     if (deviceCount == 0)
     {
-        Serial.println("연결된 센서가 없습니다.");
+        console->println(ui(UiText::NO_SENSORS));
         return;
     }
 
-    Serial.print("총 ");
-    Serial.print(deviceCount);
-    Serial.println("개의 센서 ID를 초기화합니다...");
+    console->print(ui(UiText::TOTAL_PREFIX));
+    console->print(deviceCount);
+    console->println(ui(UiText::RESET_IDS_COUNT));
 
     int resetCount = 0;
+    beginConfigTransaction();
     for (int i = 0; i < deviceCount; i++)
     {
         uint8_t currentId = getSensorLogicalId(i);
@@ -119,30 +444,32 @@ void SensorController::resetAllSensorIds()
             // ID를 0으로 설정하여 미할당 상태로 만듦 (setSensorLogicalId 사용으로 중복 쓰기 방지)
             setSensorLogicalId(i, 0);
 
-            Serial.print("센서 ");
-            Serial.print(i + 1);
-            Serial.print(" (기존 ID: ");
-            Serial.print(currentId);
-            Serial.println(") → 미할당 상태로 초기화");
+            console->print(ui(UiText::SENSOR_PREFIX));
+            console->print(i + 1);
+            console->print(ui(UiText::PREV_ID_PREFIX));
+            console->print(currentId);
+            console->println(ui(UiText::RESET_TO_UNASSIGNED));
 
             resetCount++;
         }
         else if (currentId == 0)
         {
-            Serial.print("센서 ");
-            Serial.print(i + 1);
-            Serial.println(" → 이미 미할당 상태 (건너뜀)");
+            console->print(ui(UiText::SENSOR_PREFIX));
+            console->print(i + 1);
+            console->println(ui(UiText::ALREADY_UNASSIGNED));
         }
     }
 
-    Serial.println();
-    Serial.print("초기화 완료: ");
-    Serial.print(resetCount);
-    Serial.print("/");
-    Serial.print(deviceCount);
-    Serial.println("개 센서 ID가 초기화되었습니다.");
-    Serial.println("=== 전체 센서 ID 초기화 완료 ===");
-    Serial.println();
+    commitConfigTransaction();
+
+    console->println();
+    console->print(ui(UiText::RESET_DONE_PREFIX));
+    console->print(resetCount);
+    console->print("/");
+    console->print(deviceCount);
+    console->println(ui(UiText::RESET_IDS_DONE_COUNT));
+    console->println(ui(UiText::RESET_IDS_DONE));
+    console->println();
 }
 
 const char *SensorController::getUpperState(float temp)
@@ -161,199 +488,895 @@ const char *SensorController::getLowerState(float temp)
     return (temp < DEFAULT_LOWER_THRESHOLD) ? "초과" : "정상";
 }
 
-const char *SensorController::getSensorStatus(float temp)
+const char *SensorController::getSensorStatus(float temp)
+{
+    // 기존 메서드는 기본 임계값 사용 (하위 호환성)
+    if (temp == DEVICE_DISCONNECTED_C)
+        return "오류";
+
+    if (temp > DEFAULT_UPPER_THRESHOLD || temp < DEFAULT_LOWER_THRESHOLD)
+    {
+        return "경고";
+    }
+
+    return "정상";
+}
+
+void SensorController::printSensorAddress(const DeviceAddress &addr)
+{
+    char text[Format::ROM_HEX_SIZE];
+    Format::romHex(text, sizeof(text), addr);
+    console->print("0x");
+    console->print(text);
+}
+
+void SensorController::printSensorAddress(uint64_t rom)
+{
+    DeviceAddress addr;
+    romToBytes(rom, addr);
+    printSensorAddress(addr);
+}
+
+void SensorController::printThresholdPair(float upper, float lower)
+{
+    LineBuffer line;
+    line.append("TH=").appendTenths(toTenths(upper)).append("°C, TL=");
+    line.appendTenths(toTenths(lower)).append("°C").appendLineEnd();
+    console->write(line.data(), line.length());
+}
+
+void SensorController::printSensorRow(const SensorRowInfo &row, int id)
+{
+    // 한 행을 버퍼에 조립한 뒤 write() 한 번으로 출력 (힙 할당 없음)
+    LineBuffer line;
+    line.append("| ").appendInt(id).append("    | ");
+
+    if (!row.connected)
+    {
+        line.append("NONE   | NONE         | N/A     | N/A       | N/A         | N/A         | N/A       | N/A         | N/A     |");
+    }
+    else
+    {
+        if (row.logicalId == 0)
+            line.append("미할당 | ");
+        else
+            line.appendInt(row.logicalId).append("   | ");
+
+        line.append("0x");
+        line.appendRomHex(row.addr);
+        line.append(" | ");
+
+        if (row.temp == DEVICE_DISCONNECTED_C)
+            line.append("N/A   ");
+        else
+            line.appendTemperature(Format::toSixteenths(row.temp), 1).append(row.stale ? "°C*  " : "°C   ");
+        line.append(" | ");
+
+        // 센서별 임계값 사용 - 표시 위치와 무관하게 ROM 주소로 조회
+        line.appendTenths(toTenths(getUpperThreshold(row.rom))).append("°C       | ");
+        line.append(getUpperState(row.rom, row.temp)).append("         | ");
+        line.appendTenths(toTenths(getLowerThreshold(row.rom))).append("°C       | ");
+        line.append(getLowerState(row.rom, row.temp)).append("         | ");
+        line.append(getSensorStatus(row.rom, row.temp)).append("     |");
+    }
+    writeLine(line);
+}
+
+void SensorController::printRemovedRow(uint64_t rom)
+{
+    uint8_t addr[8];
+    romToBytes(rom, addr);
+
+    LineBuffer line;
+    line.append("| -    | -     | 0x");
+    line.appendRomHex(addr);
+    line.append(ui(UiText::REMOVED_ROW));
+    writeLine(line);
+}
+
+void SensorController::startConversion()
+{
+    // 변환 완료를 기다리지 않고 요청만 전송
+    sensors.setWaitForConversion(false);
+    sensors.requestTemperatures();
+    sensors.setWaitForConversion(true);
+    conversionStartMs = millis();
+    conversionPending = true;
+}
+
+bool SensorController::isConversionReady()
+{
+    if (!conversionPending)
+        return true;
+
+    // 기생 전원 센서는 완료 비트를 읽을 수 없으므로 분해능별 변환 시간으로 판단
+    unsigned long waitMs = sensors.millisToWaitForConversion(conversionResolution);
+    return millis() - conversionStartMs >= waitMs;
+}
+
+void SensorController::updateSensorRows()
+{
+    if (conversionPending)
+    {
+        // 미리 시작한 변환 결과를 사용 (남은 시간만 대기)
+        unsigned long waitMs = sensors.millisToWaitForConversion(conversionResolution);
+        unsigned long elapsed = millis() - conversionStartMs;
+        unsigned long remainingMs = (elapsed < waitMs) ? waitMs - elapsed : 0;
+        if (remainingMs > 0)
+            delay(remainingMs);
+        conversionPending = false;
+        LOG_TRACE(&systemLogger, CONVERSION_DONE, busCount, remainingMs);
+    }
+    else
+    {
+        sensors.requestTemperatures();
+    }
+    buildSensorRows();
+    storeWarmStart();
+    warmTablePending = false;
+
+    // 부팅 후 첫 유효 측정 시점 기록 (1회만 출력)
+    if (firstReadingMs == 0)
+    {
+        for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
+        {
+            if (g_sortedSensorRows[i].connected && g_sortedSensorRows[i].temp != DEVICE_DISCONNECTED_C)
+            {
+                firstReadingMs = millis();
+                console->print(ui(UiText::FIRST_READING));
+                console->print(firstReadingMs);
+                console->println(fastBootUsed ? ui(UiText::FIRST_READING_CACHED) : ui(UiText::FIRST_READING_SEARCH));
+                break;
+            }
+        }
+    }
+}
+
+void SensorController::buildSensorRows()
+{
+    // 고정 크기 배열에서 수집/정렬 (측정 주기마다 힙 할당 없음)
+    SensorRowInfo sensorRows[SENSOR_MAX_COUNT];
+
+    collectSensorData(sensorRows);
+    sortSensorRows(sensorRows);
+    storeSortedResults(sensorRows);
+}
+
+void SensorController::printSensorStatusTable()
+{
+    // 변환 대기 후 표를 한 번에 출력
+    updateSensorRows();
+    if (getOutputMode() == OutputMode::Dashboard)
+    {
+        // 메뉴 출력으로 화면이 밀렸으므로 전체를 다시 그림
+        dashboardRedrawPending = true;
+        printDashboard();
+        return;
+    }
+    printSensorTable();
+}
+
+bool SensorController::printWarmStartTable()
+{
+    if (!warmTablePending)
+        return false;
+
+    warmTablePending = false;
+    printReportRows();
+    return true;
+}
+
+void SensorController::printSensorReport()
+{
+    updateSensorRows();
+    if (!selectReportRows())
+        return; // 변경 없음: 이번 주기는 출력하지 않음
+
+    printReportRows();
+    deltaFrame = false;
+}
+
+uint8_t SensorController::reportStatusOf(const SensorRowInfo &row)
+{
+    if (row.temp == DEVICE_DISCONNECTED_C)
+        return 3;
+    if (row.temp > getUpperThreshold(row.rom))
+        return 1;
+    if (row.temp < getLowerThreshold(row.rom))
+        return 2;
+    return 0;
+}
+
+bool SensorController::selectReportRows()
+{
+    const SystemConfig &cfg = configStore->config();
+    bool keyframe = !cfg.deltaReporting || keyframePending || reportsSinceKeyframe + 1 >= cfg.keyframeInterval;
+
+    // 새 스냅샷: 출력한 센서는 현재 값, 출력하지 않은 센서는 마지막 출력 값 유지
+    ReportedSensorState nextStates[SENSOR_MAX_COUNT];
+    uint8_t nextCount = 0;
+    bool anyChanged = false;
+
+    for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
+    {
+        const SensorRowInfo &row = g_sortedSensorRows[i];
+        rowReported[i] = false;
+        if (!row.connected)
+            continue;
+
+        ReportedSensorState current = {row.rom, 0, reportStatusOf(row)};
+        if (row.temp != DEVICE_DISCONNECTED_C)
+            current.tempCenti = toScaled(row.temp, 100);
+
+        const ReportedSensorState *last = nullptr;
+        for (uint8_t j = 0; j < reportedCount; ++j)
+        {
+            if (reportedStates[j].rom == row.rom)
+            {
+                last = &reportedStates[j];
+                break;
+            }
+        }
+
+        bool changed = keyframe || !last || last->status != current.status;
+        if (!changed && current.status != 3)
+        {
+            int32_t diff = current.tempCenti - last->tempCenti;
+            changed = (diff > cfg.deltaDeadbandCenti || -diff > cfg.deltaDeadbandCenti);
+        }
+
+        rowReported[i] = changed;
+        anyChanged |= changed;
+        nextStates[nextCount++] = changed ? current : *last;
+    }
+
+    // 지난 출력에는 있었지만 지금은 없는 센서 (연결 변화)
+    removedCount = 0;
+    for (uint8_t j = 0; j < reportedCount; ++j)
+    {
+        bool present = false;
+        for (uint8_t k = 0; k < nextCount; ++k)
+        {
+            if (nextStates[k].rom == reportedStates[j].rom)
+            {
+                present = true;
+                break;
+            }
+        }
+        if (!present && !keyframe)
+            removedRoms[removedCount++] = reportedStates[j].rom;
+    }
+
+    memcpy(reportedStates, nextStates, sizeof(ReportedSensorState) * nextCount);
+    reportedCount = nextCount;
+
+    if (keyframe)
+    {
+        keyframePending = false;
+        reportsSinceKeyframe = 0;
+        deltaFrame = false;
+        return true;
+    }
+
+    ++reportsSinceKeyframe;
+    deltaFrame = true;
+    return anyChanged || removedCount > 0;
+}
+
+void SensorController::setDeltaReporting(bool enabled)
+{
+    SystemConfig &cfg = configStore->config();
+    if (cfg.deltaReporting != (enabled ? 1 : 0))
+    {
+        cfg.deltaReporting = enabled ? 1 : 0;
+        configStore->save();
+    }
+    keyframePending = true; // 전환 직후에는 전체 출력으로 기준점 제공
+}
+
+bool SensorController::setDeltaDeadbandCenti(uint16_t centi)
+{
+    if (centi > MAX_DELTA_DEADBAND_CENTI)
+        return false;
+
+    configStore->config().deltaDeadbandCenti = centi;
+    configStore->save();
+    return true;
+}
+
+bool SensorController::setKeyframeInterval(uint8_t reports)
+{
+    if (reports == 0)
+        return false;
+
+    configStore->config().keyframeInterval = reports;
+    configStore->save();
+    return true;
+}
+
+void SensorController::printReportRows()
+{
+    switch (getOutputMode())
+    {
+    case OutputMode::Csv:
+        printCsvReport();
+        break;
+    case OutputMode::JsonLines:
+        printJsonReport();
+        break;
+    case OutputMode::Binary:
+        printBinaryReport();
+        break;
+    case OutputMode::Dashboard:
+        printDashboard();
+        break;
+    default:
+        printSensorTable();
+        break;
+    }
+}
+
+OutputMode SensorController::getOutputMode() const
+{
+    return static_cast<OutputMode>(configStore->config().outputMode);
+}
+
+void SensorController::setOutputMode(OutputMode mode)
+{
+    if (getOutputMode() != mode)
+    {
+        configStore->config().outputMode = static_cast<uint8_t>(mode);
+        configStore->save();
+    }
+
+    // CSV 헤더, 바이너리 ROM 대응표, 전체 키프레임은 전환할 때마다 다시 출력
+    csvHeaderPending = true;
+    romMapPending = true;
+    keyframePending = true;
+    dashboardRedrawPending = true;
+    console->print(ui(UiText::OUTPUT_MODE_SET));
+    console->println(getOutputModeName(mode));
+}
+
+const char *SensorController::getOutputModeName(OutputMode mode)
+{
+    switch (mode)
+    {
+    case OutputMode::Csv:
+        return "csv";
+    case OutputMode::JsonLines:
+        return "json";
+    case OutputMode::Binary:
+        return "bin";
+    case OutputMode::Dashboard:
+        return "dash";
+    default:
+        return "table";
+    }
+}
+
+void SensorController::printCsvReport()
+{
+    if (csvHeaderPending)
+    {
+        writeLine("ms,rom,id,temp_c,upper_c,lower_c,upper_state,lower_state,status,stale");
+        csvHeaderPending = false;
+    }
+
+    // 연결된 센서당 한 줄, 같은 측정 세트는 동일한 ms 값을 가짐
+    unsigned long timestamp = millis();
+    for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
+    {
+        const SensorRowInfo &row = g_sortedSensorRows[i];
+        if (!row.connected || !isRowReported(i))
+            continue;
+
+        float upper = getUpperThreshold(row.rom);
+        float lower = getLowerThreshold(row.rom);
+
+        LineBuffer line;
+        line.appendUInt(timestamp).append(',');
+        line.appendRomHex(row.addr);
+        line.append(',').appendInt(row.logicalId).append(',');
+        if (row.temp != DEVICE_DISCONNECTED_C)
+            line.appendFixed(toScaled(row.temp, 100), 2);
+        line.append(',').appendFixed(toScaled(upper, 10), 1);
+        line.append(',').appendFixed(toScaled(lower, 10), 1);
+        line.append(',').append(upperStateCode(row.temp, upper));
+        line.append(',').append(lowerStateCode(row.temp, lower));
+        line.append(',').append(statusCode(row.temp, upper, lower));
+        line.append(',').append(row.stale ? '1' : '0');
+        writeLine(line);
+    }
+
+    // 사라진 센서: 값 없이 상태만 "removed"
+    for (uint8_t i = 0; i < removedCount; ++i)
+    {
+        uint8_t addr[8];
+        romToBytes(removedRoms[i], addr);
+
+        LineBuffer line;
+        line.appendUInt(timestamp).append(',');
+        line.appendRomHex(addr);
+        line.append(",,,,,na,na,removed,0");
+        writeLine(line);
+    }
+}
+
+void SensorController::printJsonReport()
+{
+    static constexpr size_t SENSOR_FIELDS = 9;
+    static constexpr size_t JSON_CAPACITY =
+        JSON_OBJECT_SIZE(5) + 2 * JSON_ARRAY_SIZE(SENSOR_MAX_COUNT) + SENSOR_MAX_COUNT * JSON_OBJECT_SIZE(SENSOR_FIELDS);
+    static constexpr size_t JSON_LINE_SIZE = 1536;
+
+    static_assert(JSON_CAPACITY + JSON_LINE_SIZE + 2 * BumpArena::DEFAULT_ALIGNMENT <= CYCLE_ARENA_SIZE,
+                  "CYCLE_ARENA_SIZE too small for JSON report");
+
+    // 문서와 직렬화 버퍼 모두 loop() 작업 영역 사용 (힙/큰 스택 사용 없음, 함수 종료 시 반납)
+    BumpArena::Scope scope(cycleArena);
+    BasicJsonDocument<CycleArenaAllocator> doc(JSON_CAPACITY);
+    char *jsonLine = cycleArena.allocateArray<char>(JSON_LINE_SIZE);
+    if (doc.capacity() == 0 || !jsonLine)
+    {
+        writeLine("{\"error\":\"report memory\"}");
+        return;
+    }
+    char romText[SENSOR_MAX_COUNT][Format::ROM_HEX_SIZE]; // 문서는 const char*를 복사하지 않고 참조
+    char removedText[SENSOR_MAX_COUNT][Format::ROM_HEX_SIZE];
+    char tempText[SENSOR_MAX_COUNT][Format::TEMPERATURE_SIZE];
+
+    doc["ms"] = millis();
+    doc["gen"] = warmCache.generation;
+    if (deltaFrame)
+        doc["delta"] = true; // 변화한 센서만 포함 (없는 센서는 이전 값 유지)
+    JsonArray list = doc.createNestedArray("sensors");
+
+    for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
+    {
+        const SensorRowInfo &row = g_sortedSensorRows[i];
+        if (!row.connected || !isRowReported(i))
+            continue;
+
+        Format::romHex(romText[i], sizeof(romText[i]), row.addr);
+
+        float upper = getUpperThreshold(row.rom);
+        float lower = getLowerThreshold(row.rom);
+
+        JsonObject item = list.createNestedObject();
+        item["rom"] = static_cast<const char *>(romText[i]);
+        item["id"] = row.logicalId;
+        if (row.temp == DEVICE_DISCONNECTED_C)
+            item["temp"] = nullptr;
+        else
+        {
+            // 1/16°C 분해능과 보정값(0.01°C)을 모두 담는 소수 4자리, 끝의 0은 생략
+            size_t length = Format::fixed(tempText[i], sizeof(tempText[i]), toScaled(row.temp, 10000), 4);
+            Format::trimFraction(tempText[i], length);
+            item["temp"] = serialized(static_cast<const char *>(tempText[i]));
+        }
+        item["upper"] = upper;
+        item["lower"] = lower;
+        item["upperState"] = upperStateCode(row.temp, upper);
+        item["lowerState"] = lowerStateCode(row.temp, lower);
+        item["status"] = statusCode(row.temp, upper, lower);
+        item["stale"] = row.stale;
+    }
+
+    if (removedCount > 0)
+    {
+        JsonArray removed = doc.createNestedArray("removed");
+        for (uint8_t i = 0; i < removedCount; ++i)
+        {
+            uint8_t addr[8];
+            romToBytes(removedRoms[i], addr);
+            Format::romHex(removedText[i], sizeof(removedText[i]), addr);
+            removed.add(static_cast<const char *>(removedText[i]));
+        }
+    }
+
+    if (doc.overflowed() || measureJson(doc) + 2 >= JSON_LINE_SIZE)
+    {
+        writeLine("{\"error\":\"report overflow\"}");
+        return;
+    }
+
+    // 한 줄 전체를 버퍼에 직렬화한 뒤 write() 1회
+    size_t length = serializeJson(doc, jsonLine, JSON_LINE_SIZE - 2);
+    jsonLine[length++] = '\r';
+    jsonLine[length++] = '\n';
+    console->write(reinterpret_cast<const uint8_t *>(jsonLine), length);
+}
+
+void SensorController::printBinaryReport()
+{
+    // ROM 대응표: 모드 진입/센서 구성 변경 시, 이후 일정 프레임마다 재전송 (중간 접속 수신기용)
+    if (romMapPending || framesSinceRomMap >= TELEMETRY_ROM_MAP_PERIOD)
+        sendTelemetryRomMap();
+
+    Telemetry::Sample samples[SENSOR_MAX_COUNT * 2]; // 변경분 프레임은 사라진 센서도 포함
+    uint8_t count = 0;
+
+    for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
+    {
+        const SensorRowInfo &row = g_sortedSensorRows[i];
+        if (!row.connected || !isRowReported(i))
+            continue;
+
+        SensorConfigRecord *record = sensorConfigs.find(row.rom);
+        if (!record)
+            continue;
+
+        Telemetry::Sample &sample = samples[count++];
+        sample.slot = sensorConfigs.indexOf(record);
+        sample.flags = row.stale ? Telemetry::FLAG_STALE : 0;
+        sample.raw = 0;
+        if (row.temp != DEVICE_DISCONNECTED_C)
+        {
+            sample.flags |= Telemetry::FLAG_VALID;
+            sample.raw = static_cast<int16_t>(toScaled(row.temp, Telemetry::RAW_PER_DEGREE));
+            if (row.temp > record->upperThreshold)
+                sample.flags |= Telemetry::FLAG_UPPER_ALARM;
+            if (row.temp < record->lowerThreshold)
+                sample.flags |= Telemetry::FLAG_LOWER_ALARM;
+        }
+    }
+
+    for (uint8_t i = 0; i < removedCount; ++i)
+    {
+        SensorConfigRecord *record = sensorConfigs.find(removedRoms[i]);
+        if (!record)
+            continue;
+
+        Telemetry::Sample &sample = samples[count++];
+        sample.slot = sensorConfigs.indexOf(record);
+        sample.flags = Telemetry::FLAG_REMOVED;
+        sample.raw = 0;
+    }
+
+    uint8_t type = deltaFrame ? Telemetry::FRAME_DELTA : Telemetry::FRAME_SAMPLES;
+    writeTelemetryFrame(type, reinterpret_cast<const uint8_t *>(samples), count, count * sizeof(Telemetry::Sample));
+    ++framesSinceRomMap;
+}
+
+void SensorController::sendTelemetryRomMap()
 {
-    // 기존 메서드는 기본 임계값 사용 (하위 호환성)
-    if (temp == DEVICE_DISCONNECTED_C)
-        return "오류";
+    Telemetry::RomEntry entries[SENSOR_MAX_COUNT];
+    uint8_t count = 0;
 
-    if (temp > DEFAULT_UPPER_THRESHOLD || temp < DEFAULT_LOWER_THRESHOLD)
+    for (int i = 0; i < busCount; ++i)
     {
-        return "경고";
+        SensorConfigRecord *record = sensorConfigs.find(romFromBytes(busAddresses[i]));
+        if (!record)
+            continue;
+
+        entries[count].slot = sensorConfigs.indexOf(record);
+        memcpy(entries[count].rom, busAddresses[i], sizeof(DeviceAddress));
+        ++count;
     }
 
-    return "정상";
+    writeTelemetryFrame(Telemetry::FRAME_ROM_MAP, reinterpret_cast<const uint8_t *>(entries), count,
+                        count * sizeof(Telemetry::RomEntry));
+    romMapPending = false;
+    framesSinceRomMap = 0;
 }
 
-void SensorController::printSensorAddress(const DeviceAddress &addr)
+void SensorController::writeTelemetryFrame(uint8_t type, const uint8_t *body, uint8_t count, size_t bodySize)
 {
-    Serial.print("0x");
-    for (uint8_t j = 0; j < 8; j++)
-    {
-        if (addr[j] < 16)
-            Serial.print("0");
-        Serial.print(addr[j], HEX);
-    }
+    // 프레임 버퍼는 loop() 작업 영역에서 받고 반납, 완성된 프레임을 write() 1회로 출력
+    BumpArena::Scope scope(cycleArena);
+    uint8_t *payload = cycleArena.allocateArray<uint8_t>(Telemetry::MAX_PAYLOAD_SIZE);
+    uint8_t *frame = cycleArena.allocateArray<uint8_t>(Telemetry::MAX_FRAME_SIZE);
+    if (!payload || !frame)
+        return;
+
+    Telemetry::Header header;
+    header.version = Telemetry::PROTOCOL_VERSION;
+    header.type = type;
+    header.sequence = telemetrySequence++;
+    header.timestampMs = millis();
+    header.count = count;
+
+    memcpy(payload, &header, sizeof(header));
+    memcpy(payload + sizeof(header), body, bodySize);
+    size_t length = Telemetry::encodeFrame(payload, sizeof(header) + bodySize, frame);
+    console->write(frame, length);
 }
 
-void SensorController::printSensorRow(int idx, int id, const DeviceAddress &addr, float temp)
+// 대시보드 화면 배치 (1부터 시작하는 터미널 좌표)
+namespace
+{
+struct DashboardColumn
 {
-    Serial.print("| ");
-    Serial.print(id);
-    Serial.print("    | ");
-    uint8_t logicalId = getSensorLogicalId(idx);
-    bool idValid = (logicalId >= 1 && logicalId <= SENSOR_MAX_COUNT);
-    if (id == -1)
+    uint8_t col;
+    uint8_t width;
+    const char *title;
+};
+
+const DashboardColumn DASHBOARD_COLUMNS[DASHBOARD_CELL_COUNT] = {
+    {7, 6, "ID"},
+    {14, 18, "센서 주소"},
+    {33, 10, "현재 온도"},
+    {44, 9, "상한"},
+    {54, 9, "상한상태"},
+    {64, 9, "하한"},
+    {74, 9, "하한상태"},
+    {84, 9, "센서상태"},
+};
+
+constexpr uint8_t DASHBOARD_TITLE_ROW = 1;
+constexpr uint8_t DASHBOARD_HEADER_ROW = 3;
+constexpr uint8_t DASHBOARD_FIRST_SENSOR_ROW = 5;
+constexpr uint8_t DASHBOARD_STATUS_ROW = DASHBOARD_FIRST_SENSOR_ROW + SENSOR_MAX_COUNT + 1;
+constexpr uint8_t DASHBOARD_INPUT_ROW = DASHBOARD_STATUS_ROW + 3; // 입력 에코 위치
+constexpr uint8_t DASHBOARD_WIDTH = 93;
+constexpr size_t DASHBOARD_CELL_MAX = 24; // 칸 내용 최대 바이트 (UTF-8)
+} // namespace
+
+void SensorController::printDashboard()
+{
+    uint32_t startCycles = CycleCounter::now();
+    renderStats.bytes = 0;
+    renderStats.lines = 0;
+    renderStats.truncatedLines = 0;
+
+    LineBuffer out;
+    bool redraw = dashboardRedrawPending;
+    if (redraw)
     {
-        Serial.print("NONE   | NONE         | N/A     | N/A       | N/A         | N/A         | N/A       | N/A         | N/A     |");
+        drawDashboardFrame(out);
+        dashboardRedrawPending = false;
     }
-    else
+
+    // 칸별 내용을 만들고 이전과 달라진 칸만 커서 이동 후 다시 씀
+    uint16_t changedCells = 0;
+    for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
     {
-        if (logicalId == 0)
-        {
-            Serial.print("미할당");
-            Serial.print(" | ");
-        }
-        else if (idValid)
-        {
-            Serial.print(logicalId);
-            Serial.print("   | ");
-        }
-        else
-        {
-            Serial.print("ERR");
-            Serial.print("   | ");
-        }
-        printSensorAddress(addr);
-        Serial.print(" | ");
-        if (temp == DEVICE_DISCONNECTED_C)
-            Serial.print("N/A   ");
-        else
-        {
-            Serial.print(temp, 1);
-            Serial.print("°C   ");
-        }
-        Serial.print(" | ");
-        // 센서별 임계값 사용 - 표시 행 번호(id-1)를 인덱스로 사용
-        int displayRowIdx = id - 1; // 표시되는 행 번호를 0-based 인덱스로 변환
-        if (logicalId >= 1 && logicalId <= SENSOR_MAX_COUNT)
+        const SensorRowInfo &row = g_sortedSensorRows[i];
+        uint8_t screenRow = DASHBOARD_FIRST_SENSOR_ROW + i;
+        bool hasTemp = row.connected && row.temp != DEVICE_DISCONNECTED_C;
+        char cells[DASHBOARD_CELL_COUNT][DASHBOARD_CELL_MAX];
+
+        LineBuffer cell;
+        for (uint8_t c = 0; c < DASHBOARD_CELL_COUNT; ++c)
         {
-            // ID가 할당된 센서: 표시 행 인덱스로 임계값 조회
-            Serial.print(getUpperThreshold(displayRowIdx), 1);
-            Serial.print("°C       | ");
-            Serial.print(getUpperState(displayRowIdx, temp));
-            Serial.print("         | ");
-            Serial.print(getLowerThreshold(displayRowIdx), 1);
-            Serial.print("°C       | ");
-            Serial.print(getLowerState(displayRowIdx, temp));
-            Serial.print("         | ");
-            Serial.print(getSensorStatus(displayRowIdx, temp));
-            Serial.print("     |");
+            cell.clear();
+            if (!row.connected)
+            {
+                cell.append(c == 0 ? "NONE" : "N/A");
+            }
+            else
+            {
+                switch (c)
+                {
+                case 0:
+                    if (row.logicalId == 0)
+                        cell.append("미할당");
+                    else
+                        cell.appendInt(row.logicalId);
+                    break;
+                case 1:
+                    cell.appendRomHex(row.addr);
+                    break;
+                case 2:
+                    if (hasTemp)
+                        cell.appendTemperature(Format::toSixteenths(row.temp), 1).append(row.stale ? "°C*" : "°C");
+                    else
+                        cell.append("N/A");
+                    break;
+                case 3:
+                    cell.appendTenths(toTenths(getUpperThreshold(row.rom))).append("°C");
+                    break;
+                case 4:
+                    cell.append(getUpperState(row.rom, row.temp));
+                    break;
+                case 5:
+                    cell.appendTenths(toTenths(getLowerThreshold(row.rom))).append("°C");
+                    break;
+                case 6:
+                    cell.append(getLowerState(row.rom, row.temp));
+                    break;
+                default:
+                    cell.append(getSensorStatus(row.rom, row.temp));
+                    break;
+                }
+            }
+            strncpy(cells[c], cell.c_str(), DASHBOARD_CELL_MAX - 1);
+            cells[c][DASHBOARD_CELL_MAX - 1] = '\0';
         }
-        else
+
+        for (uint8_t c = 0; c < DASHBOARD_CELL_COUNT; ++c)
         {
-            // ID가 없는 센서도 표시 행 인덱스로 임계값 조회 (일관성 유지)
-            Serial.print(getUpperThreshold(displayRowIdx), 1);
-            Serial.print("°C       | ");
-            Serial.print(getUpperState(displayRowIdx, temp));
-            Serial.print("         | ");
-            Serial.print(getLowerThreshold(displayRowIdx), 1);
-            Serial.print("°C       | ");
-            Serial.print(getLowerState(displayRowIdx, temp));
-            Serial.print("         | ");
-            Serial.print(getSensorStatus(displayRowIdx, temp));
-            Serial.print("     |");
+            uint16_t crc = crc16Ccitt(cells[c], strlen(cells[c]));
+            if (!redraw && dashboardCells[i][c] == crc)
+                continue;
+            dashboardCells[i][c] = crc;
+            appendDashboardCell(out, screenRow, c, cells[c], changedCells);
         }
     }
-    Serial.println();
+
+    // 상태 줄은 매번 갱신 (줄 끝까지 지움), 커서는 입력 위치로 복귀
+    ++dashboardUpdates;
+    if (out.length() + 80 > LineBuffer::CAPACITY)
+        flushDashboard(out);
+    AnsiTerminal::appendCursorTo(out, DASHBOARD_STATUS_ROW, 1)
+        .append("갱신 #")
+        .appendInt(static_cast<int32_t>(dashboardUpdates))
+        .append("  ")
+        .appendInt(static_cast<int32_t>(millis() / 1000))
+        .append(" s  바뀐 칸 ")
+        .appendInt(changedCells)
+        .append("\x1B[K");
+    AnsiTerminal::appendCursorTo(out, DASHBOARD_INPUT_ROW, 1);
+    flushDashboard(out);
+
+    renderStats.cycles = CycleCounter::now() - startCycles;
 }
 
-void SensorController::updateSensorRows()
+void SensorController::drawDashboardFrame(LineBuffer &out)
 {
-    sensors.requestTemperatures();
-    std::vector<SensorRowInfo> sensorRows;
+    out.append(AnsiTerminal::CLEAR_SCREEN);
+    AnsiTerminal::appendCursorTo(out, DASHBOARD_TITLE_ROW, 1).append("=== DS18B20 센서 대시보드 ===");
+    flushDashboard(out);
 
-    collectSensorData(sensorRows);
-    sortSensorRows(sensorRows);
-    storeSortedResults(sensorRows);
+    AnsiTerminal::appendCursorTo(out, DASHBOARD_HEADER_ROW, 1).append("번호");
+    for (uint8_t c = 0; c < DASHBOARD_CELL_COUNT; ++c)
+    {
+        AnsiTerminal::appendCursorTo(out, DASHBOARD_HEADER_ROW, DASHBOARD_COLUMNS[c].col).append(DASHBOARD_COLUMNS[c].title);
+    }
+    flushDashboard(out);
+
+    AnsiTerminal::appendCursorTo(out, DASHBOARD_HEADER_ROW + 1, 1);
+    for (uint8_t i = 0; i < DASHBOARD_WIDTH; ++i)
+    {
+        out.append('-');
+    }
+    flushDashboard(out);
+
+    for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
+    {
+        AnsiTerminal::appendCursorTo(out, DASHBOARD_FIRST_SENSOR_ROW + i, 1).appendInt(i + 1);
+    }
+    AnsiTerminal::appendCursorTo(out, DASHBOARD_STATUS_ROW + 1, 1).append("메뉴: 'menu' 입력, 표 출력으로 전환: 'mode table'");
+    flushDashboard(out);
 }
 
-void SensorController::printSensorStatusTable()
+void SensorController::appendDashboardCell(LineBuffer &out, uint8_t screenRow, uint8_t cell, const char *text, uint16_t &changedCells)
 {
-    Serial.println("| 번호 | ID  | 센서 주소           | 현재 온도 | 상한임계값   | 상한초과상태 | 하한임계값   | 하한초과상태 | 센서상태 |");
-    Serial.println("| ---- | --- | ------------       | ---------  | ------------ | ------------ | ------------ | ------------ | -------- |");
+    const DashboardColumn &column = DASHBOARD_COLUMNS[cell];
+    if (out.length() + strlen(text) + column.width + 12 > LineBuffer::CAPACITY)
+        flushDashboard(out);
 
-    updateSensorRows();
+    // 이전 내용이 남지 않도록 칸 폭까지 공백으로 채움
+    AnsiTerminal::appendCursorTo(out, screenRow, column.col).append(text);
+    for (uint8_t width = AnsiTerminal::displayWidth(text); width < column.width; ++width)
+    {
+        out.append(' ');
+    }
+    ++changedCells;
+}
+
+void SensorController::flushDashboard(LineBuffer &out)
+{
+    if (out.length() == 0)
+        return;
+    if (out.isTruncated())
+        renderStats.truncatedLines++;
+    console->write(out.data(), out.length());
+    renderStats.bytes += out.length();
+    renderStats.lines++;
+    out.clear();
+}
+
+void SensorController::printSensorTable()
+{
+    uint32_t startCycles = CycleCounter::now();
+    renderStats.bytes = 0;
+    renderStats.lines = 0;
+    renderStats.truncatedLines = 0;
+
+    writeLine("| 번호 | ID  | 센서 주소           | 현재 온도 | 상한임계값   | 상한초과상태 | 하한임계값   | 하한초과상태 | 센서상태 |");
+    writeLine("| ---- | --- | ------------       | ---------  | ------------ | ------------ | ------------ | ------------ | -------- |");
 
+    // ID 오류 목록도 고정 버퍼에 누적 (String 연결 없음)
+    LineBuffer idErrors;
+    idErrors.append(ui(UiText::ID_ERROR_WARNING));
     bool idErrorFound = false;
-    String idErrorList = "";
 
     // 1~8번 행을 모두 출력: 정렬된 센서, 그 뒤 미연결 센서
     for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
     {
         const auto &row = g_sortedSensorRows[i];
-        if (row.connected)
+        if (row.connected && row.logicalId == 0)
         {
-            if (row.logicalId < 1 || row.logicalId > SENSOR_MAX_COUNT)
-            {
-                idErrorFound = true;
-                idErrorList += String(row.idx + 1) + "(0x";
-                for (uint8_t j = 0; j < 8; j++)
-                {
-                    if (row.addr[j] < 16)
-                        idErrorList += "0";
-                    idErrorList += String(row.addr[j], HEX);
-                }
-                idErrorList += ") ";
-            }
-            printSensorRow(row.idx, i + 1, row.addr, row.temp);
+            idErrorFound = true;
+            idErrors.appendInt(row.idx + 1).append("(0x");
+            idErrors.appendRomHex(row.addr);
+            idErrors.append(") ");
         }
-        else
+        if (isRowReported(i))
+            printSensorRow(row, i + 1);
+    }
+    writeLine("=================================================================================================================");
+
+    // 변경분 출력: 사라진 센서와 한 줄 요약만 덧붙이고 안내 문구는 생략
+    if (deltaFrame)
+    {
+        for (uint8_t i = 0; i < removedCount; ++i)
         {
-            DeviceAddress dummy = {0};
-            printSensorRow(-1, i + 1, dummy, DEVICE_DISCONNECTED_C);
+            printRemovedRow(removedRoms[i]);
         }
+        LineBuffer note;
+        note.append(ui(UiText::DELTA_NOTE)).appendInt(configStore->config().keyframeInterval).append(ui(UiText::DELTA_NOTE_END));
+        writeLine(note);
+        renderStats.cycles = CycleCounter::now() - startCycles;
+        return;
     }
-    Serial.println("=================================================================================================================");
-    Serial.println("=================================================================================================================");
+
+    writeLine("=================================================================================================================");
+    if (g_sortedSensorRows[0].stale)
+        writeLine(ui(UiText::WARM_NOTE));
     if (idErrorFound)
     {
-        Serial.print("[경고] 유효하지 않은 센서 ID(1~8 범위 밖) 감지: 센서 번호/주소: ");
-        Serial.println(idErrorList);
-        Serial.println("각 센서의 논리 ID(alarmHigh)는 반드시 1~8 범위여야 합니다. 메뉴에서 ID를 재설정하세요.");
+        writeLine(idErrors);
+        writeLine(ui(UiText::ID_ERROR_HINT));
     }
-    Serial.println("센서 제어 메뉴 진입: 'menu' 또는 'm' 입력");
-    Serial.println("(센서 ID/임계값/상태 관리 등은 메뉴에서 설정 가능)");
+    writeLine(ui(UiText::MENU_HINT));
+    writeLine(ui(UiText::MENU_HINT_DETAIL));
+
+    renderStats.cycles = CycleCounter::now() - startCycles;
 }
-void SensorController::collectSensorData(std::vector<SensorRowInfo> &sensorRows)
+
+void SensorController::writeLine(LineBuffer &line)
 {
-    int deviceCount = sensors.getDeviceCount();
+    if (line.isTruncated())
+        renderStats.truncatedLines++;
+    line.appendLineEnd();
+    console->write(line.data(), line.length());
+    renderStats.bytes += line.length();
+    renderStats.lines++;
+}
 
+void SensorController::writeLine(const char *text)
+{
+    LineBuffer line;
+    line.append(text);
+    writeLine(line);
+}
+
+void SensorController::collectSensorData(SensorRowInfo *sensorRows)
+{
     for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
     {
-        SensorRowInfo rowInfo = createSensorRowInfo(i, deviceCount);
-        sensorRows.push_back(rowInfo);
+        sensorRows[i] = createSensorRowInfo(i);
     }
 }
 
-SensorRowInfo SensorController::createSensorRowInfo(int idx, int deviceCount)
+SensorRowInfo SensorController::createSensorRowInfo(int idx)
 {
-    DeviceAddress addr = {0};
-    float temp = DEVICE_DISCONNECTED_C;
-    bool connected = false;
+    SensorRowInfo rowInfo = {idx, 0, 0, {0}, DEVICE_DISCONNECTED_C, false, false};
 
-    if (idx < deviceCount && sensors.getAddress(addr, idx))
-    {
-        temp = sensors.getTempC(addr);
-        connected = true;
-    }
+    if (idx >= busCount)
+        return rowInfo;
 
-    int logicalId = getSensorLogicalId(idx);
-    SensorRowInfo rowInfo = {idx, logicalId, {0}, temp, connected};
+    memcpy(rowInfo.addr, busAddresses[idx], sizeof(DeviceAddress));
+    rowInfo.rom = romFromBytes(busAddresses[idx]);
+    rowInfo.connected = true;
+    rowInfo.temp = sensors.getTempC(busAddresses[idx]);
 
-    // Copy address
-    for (size_t k = 0; k < sizeof(DeviceAddress); ++k)
-    {
-        rowInfo.addr[k] = addr[k];
-    }
+    // ROM 주소로 설정 레코드 조회 (O(1)) 후 논리 ID와 보정값 적용
+    const SensorConfigRecord *record = sensorConfigs.find(rowInfo.rom);
+    rowInfo.logicalId = rowLogicalId(record);
+    if (record && rowInfo.temp != DEVICE_DISCONNECTED_C)
+        rowInfo.temp += record->calibrationCenti / 100.0f;
 
     return rowInfo;
 }
 
-void SensorController::sortSensorRows(std::vector<SensorRowInfo> &sensorRows)
+void SensorController::sortSensorRows(SensorRowInfo *sensorRows)
 {
-    // ID 할당된 센서 → ID 미할당 센서 → 미연결 센서 순으로 정렬
-    std::sort(sensorRows.begin(), sensorRows.end(), [](const SensorRowInfo &a, const SensorRowInfo &b)
+    // ID 할당된 센서 → ID 미할당 센서 → 미연결 센서 순으로 정렬 (제자리 정렬)
+    std::sort(sensorRows, sensorRows + SENSOR_MAX_COUNT, [](const SensorRowInfo &a, const SensorRowInfo &b)
               {
         // 연결 상태가 다르면 연결된 센서를 앞으로
         if (a.connected != b.connected) {
@@ -366,8 +1389,8 @@ void SensorController::sortSensorRows(std::vector<SensorRowInfo> &sensorRows)
         }
         
         // 둘 다 연결된 경우: ID 할당 상태에 따라 분류
-        bool aHasId = (a.logicalId >= 1 && a.logicalId <= SENSOR_MAX_COUNT);
-        bool bHasId = (b.logicalId >= 1 && b.logicalId <= SENSOR_MAX_COUNT);
+        bool aHasId = (a.logicalId != 0);
+        bool bHasId = (b.logicalId != 0);
         
         // ID 할당 상태가 다르면 ID가 있는 센서를 앞으로
         if (aHasId != bHasId) {
@@ -383,7 +1406,7 @@ void SensorController::sortSensorRows(std::vector<SensorRowInfo> &sensorRows)
         return a.idx < b.idx; });
 }
 
-void SensorController::storeSortedResults(const std::vector<SensorRowInfo> &sensorRows)
+void SensorController::storeSortedResults(const SensorRowInfo *sensorRows)
 {
     // 정렬 결과를 전역 배열에 저장
     for (int i = 0; i < SENSOR_MAX_COUNT; ++i)
@@ -392,242 +1415,494 @@ void SensorController::storeSortedResults(const std::vector<SensorRowInfo> &sens
     }
 }
 
-// ========== 센서 임계값 관리 메서드들 ==========
+bool SensorController::restoreWarmStart()
+{
+    if (!warmCache.isValid())
+    {
+        // 전원 인가 직후: RAM 내용이 임의 값이므로 초기화
+        warmCache.clear();
+        return false;
+    }
 
-void SensorController::initializeThresholds()
+    // 새 부팅 세대 시작 → 캐시된 측정값은 모두 stale
+    warmCache.generation++;
+    warmCache.seal();
+    if (!warmCache.hasStaleSamples())
+        return false;
+
+    // 현재 버스에 있는 센서만 캐시 순서(직전 표시 순서)대로 채움
+    int row = 0;
+    for (uint8_t i = 0; i < warmCache.count && row < SENSOR_MAX_COUNT; ++i)
+    {
+        const WarmStartEntry &entry = warmCache.entries[i];
+        for (int idx = 0; idx < busCount; ++idx)
+        {
+            if (romFromBytes(busAddresses[idx]) != entry.rom)
+                continue;
+
+            // 버스 읽기 없이 캐시 값으로만 행 구성
+            SensorRowInfo &info = g_sortedSensorRows[row++];
+            const SensorConfigRecord *record = sensorConfigs.find(entry.rom);
+            info.idx = idx;
+            info.logicalId = rowLogicalId(record);
+            info.rom = entry.rom;
+            memcpy(info.addr, busAddresses[idx], sizeof(DeviceAddress));
+            info.temp = entry.tempCenti / 100.0f;
+            info.connected = true;
+            info.stale = true;
+            break;
+        }
+    }
+    for (; row < SENSOR_MAX_COUNT; ++row)
+    {
+        g_sortedSensorRows[row] = {row, 0, 0, {0}, DEVICE_DISCONNECTED_C, false, false};
+    }
+
+    warmTablePending = g_sortedSensorRows[0].connected;
+    return warmTablePending;
+}
+
+void SensorController::storeWarmStart()
 {
-    Serial.print("EEPROM 임계값 로드 중");
+    // 통계는 이전 캐시 항목을 이어받아 누적 (행 순서가 바뀌어도 ROM으로 매칭)
+    WarmStartEntry entries[WARM_START_MAX_ENTRIES];
+    uint8_t count = 0;
 
-    for (int i = 0; i < SENSOR_MAX_COUNT; i++)
+    for (int i = 0; i < SENSOR_MAX_COUNT && count < WARM_START_MAX_ENTRIES; ++i)
     {
-        // 안전한 초기화: 먼저 기본값으로 설정
-        sensorThresholds[i].upperThreshold = DEFAULT_UPPER_THRESHOLD;
-        sensorThresholds[i].lowerThreshold = DEFAULT_LOWER_THRESHOLD;
-        sensorThresholds[i].isCustomSet = false;
+        const SensorRowInfo &row = g_sortedSensorRows[i];
+        if (!row.connected || row.temp == DEVICE_DISCONNECTED_C)
+            continue;
 
-        // EEPROM에서 로드 시도
-        loadSensorThresholds(i);
-        Serial.print(".");
-        delay(5); // 각 센서 로드 후 짧은 지연
+        WarmStartEntry &entry = entries[count++];
+        int16_t centi = static_cast<int16_t>(lroundf(row.temp * 100.0f));
+        const WarmStartEntry *previous = warmCache.find(row.rom);
+
+        entry.rom = row.rom;
+        entry.tempCenti = centi;
+        entry.minCenti = (previous && previous->minCenti < centi) ? previous->minCenti : centi;
+        entry.maxCenti = (previous && previous->maxCenti > centi) ? previous->maxCenti : centi;
+        entry.sampleCount = previous ? previous->sampleCount + 1 : 1;
+        entry.alarmFlags = 0;
+        if (row.temp > getUpperThreshold(row.rom))
+            entry.alarmFlags |= WARM_ALARM_UPPER;
+        if (row.temp < getLowerThreshold(row.rom))
+            entry.alarmFlags |= WARM_ALARM_LOWER;
+
+        // 경보 상태가 바뀐 센서만 알림 (리셋 후에도 캐시의 이전 상태와 비교)
+        uint8_t previousFlags = previous ? previous->alarmFlags : 0;
+        if (entry.alarmFlags != previousFlags)
+        {
+            LOG_TRACE(&systemLogger, ALARM_CHANGED, row.logicalId, previousFlags, entry.alarmFlags, centi);
+            printAlarmTransition(row, previousFlags, entry.alarmFlags);
+        }
     }
 
-    Serial.println(" 완료");
-
-    // 측정 주기도 함께 초기화
-    initializeMeasurementInterval();
+    memcpy(warmCache.entries, entries, sizeof(WarmStartEntry) * count);
+    warmCache.count = count;
+    warmCache.sampleGeneration = warmCache.generation;
+    warmCache.seal();
 }
 
-void SensorController::loadSensorThresholds(int sensorIdx)
+void SensorController::printAlarmTransition(const SensorRowInfo &row, uint8_t previousFlags, uint8_t flags)
 {
-    if (sensorIdx < 0 || sensorIdx >= SENSOR_MAX_COUNT)
+    // 기계 판독용 형식에는 텍스트 줄을 섞지 않음 (상태는 각 형식의 필드로 전달됨)
+    if (getOutputMode() != OutputMode::Table)
         return;
 
-    int addr = getEEPROMAddress(sensorIdx);
+    LineBuffer line;
+    if (flags & WARM_ALARM_UPPER)
+        line.append(ui(UiText::ALARM_UPPER));
+    else if (flags & WARM_ALARM_LOWER)
+        line.append(ui(UiText::ALARM_LOWER));
+    else
+        line.append(ui(UiText::ALARM_CLEARED)).append((previousFlags & WARM_ALARM_UPPER) ? ui(UiText::ALARM_UPPER_NAME) : ui(UiText::ALARM_LOWER_NAME)).append(ui(UiText::ALARM_BACK_TO_NORMAL));
+
+    line.appendInt(row.logicalId).append(" (0x");
+    line.appendRomHex(row.addr);
+    line.append(") ").appendTemperature(Format::toSixteenths(row.temp), 1).append("°C");
+    if (flags & WARM_ALARM_UPPER)
+        line.append(" > ").appendTenths(toTenths(getUpperThreshold(row.rom))).append("°C");
+    else if (flags & WARM_ALARM_LOWER)
+        line.append(" < ").appendTenths(toTenths(getLowerThreshold(row.rom))).append("°C");
+
+    line.appendLineEnd();
+    alarmConsole->write(line.data(), line.length());
+}
+
+// ========== 센서 임계값 관리 메서드들 ==========
+
+void SensorController::initializeThresholds()
+{
+    console->print(ui(UiText::CONFIG_LOADING));
+
+    // 저널에서 설정 레코드 전체를 한 번에 로드
+    IConfigStore::LoadResult result = configStore->load();
+    sensorConfigs.rebuild();
+
+    console->print(ui(UiText::CONFIG_LOADED));
+    console->print(configStore->getSequence());
+    console->println(")");
+
+    if (result == IConfigStore::MIGRATED_LEGACY)
+        console->println(ui(UiText::CONFIG_MIGRATED_LEGACY));
+    else if (result == IConfigStore::UPGRADED)
+        console->println(ui(UiText::CONFIG_UPGRADED));
+    else if (result == IConfigStore::DEFAULTS)
+        console->println(ui(UiText::CONFIG_DEFAULTS));
+
+    // 값 자체의 유효성 검사 (CRC는 통과했지만 범위를 벗어난 경우 대비)
+    bool needsSave = false;
+    for (uint8_t i = 0; i < sensorConfigs.capacity(); i++)
+    {
+        SensorConfigRecord *record = sensorConfigs.recordAt(i);
+        if (record->rom == 0)
+            continue;
+
+        // packed 구조체 필드는 참조로 넘기지 않고 지역 변수로 검증
+        float upper = record->upperThreshold;
+        float lower = record->lowerThreshold;
+        if (sanitizeThresholds(upper, lower))
+        {
+            record->upperThreshold = upper;
+            record->lowerThreshold = lower;
+            record->isCustomSet = 0;
+            needsSave = true;
+        }
+        if (record->resolution < 9 || record->resolution > 12)
+        {
+            record->resolution = DEFAULT_SENSOR_RESOLUTION;
+            needsSave = true;
+        }
+    }
+
+    if (configStore->config().outputMode > static_cast<uint8_t>(OutputMode::Dashboard))
+    {
+        configStore->config().outputMode = static_cast<uint8_t>(OutputMode::Table);
+        needsSave = true;
+    }
+    SystemConfig &cfg = configStore->config();
+    if (cfg.deltaReporting > 1 || cfg.deltaDeadbandCenti > MAX_DELTA_DEADBAND_CENTI || cfg.keyframeInterval == 0)
+    {
+        cfg.deltaReporting = 0;
+        cfg.deltaDeadbandCenti = DEFAULT_DELTA_DEADBAND_CENTI;
+        cfg.keyframeInterval = DEFAULT_KEYFRAME_INTERVAL;
+        needsSave = true;
+    }
+
+    // 측정 주기도 함께 초기화
+    initializeMeasurementInterval();
 
-    // EEPROM에서 임계값 읽기
-    EEPROM.get(addr, sensorThresholds[sensorIdx].upperThreshold);
-    EEPROM.get(addr + 4, sensorThresholds[sensorIdx].lowerThreshold);
+    if (needsSave)
+        configStore->save(); // 손상된 데이터가 있었다면 기본값 저장 (조용히)
+}
 
-    // 유효성 검사 (초기값 또는 손상된 데이터 처리)
+bool SensorController::sanitizeThresholds(float &upper, float &lower)
+{
     bool needsReset = false;
 
-    if (isnan(sensorThresholds[sensorIdx].upperThreshold) ||
-        !isValidTemperature(sensorThresholds[sensorIdx].upperThreshold))
+    if (isnan(upper) || !isValidTemperature(upper))
     {
-        sensorThresholds[sensorIdx].upperThreshold = DEFAULT_UPPER_THRESHOLD;
+        upper = DEFAULT_UPPER_THRESHOLD;
         needsReset = true;
     }
 
-    if (isnan(sensorThresholds[sensorIdx].lowerThreshold) ||
-        !isValidTemperature(sensorThresholds[sensorIdx].lowerThreshold))
+    if (isnan(lower) || !isValidTemperature(lower))
     {
-        sensorThresholds[sensorIdx].lowerThreshold = DEFAULT_LOWER_THRESHOLD;
+        lower = DEFAULT_LOWER_THRESHOLD;
         needsReset = true;
     }
 
     // 논리 검증: 상한값이 하한값보다 작으면 기본값으로 리셋
-    if (sensorThresholds[sensorIdx].upperThreshold <= sensorThresholds[sensorIdx].lowerThreshold)
+    if (upper <= lower)
     {
-        sensorThresholds[sensorIdx].upperThreshold = DEFAULT_UPPER_THRESHOLD;
-        sensorThresholds[sensorIdx].lowerThreshold = DEFAULT_LOWER_THRESHOLD;
+        upper = DEFAULT_UPPER_THRESHOLD;
+        lower = DEFAULT_LOWER_THRESHOLD;
         needsReset = true;
     }
 
-    // 손상된 데이터가 있었다면 EEPROM에 기본값 저장 (조용히)
-    if (needsReset)
+    return needsReset;
+}
+
+void SensorController::saveSensorThresholds(uint64_t rom)
+{
+    if (!configStore->save())
     {
-        saveSensorThresholds(sensorIdx, false); // verbose = false
-        sensorThresholds[sensorIdx].isCustomSet = false;
+        console->println(ui(UiText::ERR_CONFIG_SAVE));
+        return;
     }
-    else
+
+    // 트랜잭션 중에는 commit 시점에 한 번만 저장 메시지 출력
+    const SensorConfigRecord *record = sensorConfigs.find(rom);
+    if (record && !configStore->inTransaction())
     {
-        sensorThresholds[sensorIdx].isCustomSet = true;
+        console->print(ui(UiText::EEPROM_SAVE_SENSOR));
+        printSensorAddress(rom);
+        console->print(": ");
+        printThresholdPair(record->upperThreshold, record->lowerThreshold);
     }
 }
 
-void SensorController::saveSensorThresholds(int sensorIdx)
+float SensorController::getUpperThreshold(uint64_t rom)
 {
-    saveSensorThresholds(sensorIdx, true); // 기본적으로 출력 활성화
+    const SensorConfigRecord *record = sensorConfigs.find(rom);
+    if (!record)
+    {
+        return DEFAULT_UPPER_THRESHOLD;
+    }
+    return record->upperThreshold;
 }
 
-void SensorController::saveSensorThresholds(int sensorIdx, bool verbose)
+float SensorController::getLowerThreshold(uint64_t rom)
 {
-    if (sensorIdx < 0 || sensorIdx >= SENSOR_MAX_COUNT)
-        return;
+    const SensorConfigRecord *record = sensorConfigs.find(rom);
+    if (!record)
+    {
+        return DEFAULT_LOWER_THRESHOLD;
+    }
+    return record->lowerThreshold;
+}
 
-    int addr = getEEPROMAddress(sensorIdx);
+bool SensorController::setThresholds(uint64_t rom, float upperTemp, float lowerTemp)
+{
+    // 임계값은 센서 ROM 주소에 귀속되므로 표시 순서나 배선이 바뀌어도 유지됨
+    if (rom == 0)
+    {
+        console->println(ui(UiText::ERR_BAD_ROM));
+        return false;
+    }
 
-    // 값이 변경된 경우에만 EEPROM 쓰기 (수명 연장)
-    float currentUpper, currentLower;
-    EEPROM.get(addr, currentUpper);
-    EEPROM.get(addr + 4, currentLower);
+    // 입력 검증
+    if (!isValidTemperature(upperTemp) || !isValidTemperature(lowerTemp))
+    {
+        console->println(ui(UiText::ERR_TEMP_RANGE));
+        return false;
+    }
 
-    if (currentUpper != sensorThresholds[sensorIdx].upperThreshold)
+    if (upperTemp <= lowerTemp)
     {
-        EEPROM.put(addr, sensorThresholds[sensorIdx].upperThreshold);
+        console->println(ui(UiText::ERR_UPPER_NOT_ABOVE_LOWER));
+        return false;
     }
 
-    if (currentLower != sensorThresholds[sensorIdx].lowerThreshold)
+    SensorConfigRecord *record = ensureSensorConfig(rom);
+    if (!record)
     {
-        EEPROM.put(addr + 4, sensorThresholds[sensorIdx].lowerThreshold);
+        console->println(ui(UiText::ERR_CONFIG_TABLE_FULL));
+        return false;
     }
 
-    if (verbose)
+    // 임계값 설정 (값이 변경된 경우에만 저장하여 수명 연장)
+    if (record->upperThreshold != upperTemp || record->lowerThreshold != lowerTemp || !record->isCustomSet)
     {
-        Serial.print("💾 EEPROM 저장 - 센서 ");
-        Serial.print(sensorIdx + 1);
-        Serial.print(": TH=");
-        Serial.print(sensorThresholds[sensorIdx].upperThreshold, 1);
-        Serial.print("°C, TL=");
-        Serial.print(sensorThresholds[sensorIdx].lowerThreshold, 1);
-        Serial.println("°C");
+        record->upperThreshold = upperTemp;
+        record->lowerThreshold = lowerTemp;
+        record->isCustomSet = 1;
+
+        saveSensorThresholds(rom);
+        LOG_TRACE(&systemLogger, THRESHOLD_SET, static_cast<uint32_t>(rom), toScaled(upperTemp, 100),
+                  toScaled(lowerTemp, 100));
     }
+
+    console->print(ui(UiText::DONE_SENSOR_PREFIX));
+    printSensorAddress(rom);
+    console->print(ui(UiText::THRESHOLDS_SET));
+    printThresholdPair(upperTemp, lowerTemp);
+    return true;
 }
 
-int SensorController::getEEPROMAddress(int sensorIdx)
+bool SensorController::isValidTemperature(float temp)
 {
-    return EEPROM_BASE_ADDR + (sensorIdx * EEPROM_SIZE_PER_SENSOR);
+    return (temp >= DS18B20_MIN_TEMP && temp <= DS18B20_MAX_TEMP);
 }
 
-float SensorController::getUpperThreshold(int sensorIdx)
+bool SensorController::setSensorResolution(uint64_t rom, uint8_t bits)
 {
-    if (sensorIdx < 0 || sensorIdx >= SENSOR_MAX_COUNT)
+    if (bits < 9 || bits > 12)
     {
-        return DEFAULT_UPPER_THRESHOLD;
+        console->println(ui(UiText::ERR_RESOLUTION));
+        return false;
     }
-    return sensorThresholds[sensorIdx].upperThreshold;
-}
 
-float SensorController::getLowerThreshold(int sensorIdx)
-{
-    if (sensorIdx < 0 || sensorIdx >= SENSOR_MAX_COUNT)
+    SensorConfigRecord *record = ensureSensorConfig(rom);
+    if (!record)
     {
-        return DEFAULT_LOWER_THRESHOLD;
+        console->println(ui(UiText::ERR_CONFIG_TABLE_FULL));
+        return false;
     }
-    return sensorThresholds[sensorIdx].lowerThreshold;
+
+    if (record->resolution != bits)
+    {
+        record->resolution = bits;
+        configStore->save();
+    }
+
+    // 버스에 연결된 센서라면 즉시 적용
+    DeviceAddress addr;
+    romToBytes(rom, addr);
+    if (sensors.isConnected(addr))
+        sensors.setResolution(addr, bits, true);
+    updateConversionResolution();
+    return true;
 }
 
-void SensorController::setThresholds(int sensorIdx, float upperTemp, float lowerTemp)
+bool SensorController::setCalibrationOffset(uint64_t rom, float offsetC)
 {
-    // sensorIdx는 표시 행 번호 기반 인덱스 (0-7)
-    // 센서 논리 ID와는 무관하게 표시되는 위치로 임계값을 관리
-    if (sensorIdx < 0 || sensorIdx >= SENSOR_MAX_COUNT)
+    // 보정값은 0.01°C 단위 정수로 저장 (±5°C 제한)
+    if (isnan(offsetC) || offsetC < -5.0f || offsetC > 5.0f)
     {
-        Serial.println("❌ 오류: 잘못된 센서 인덱스");
-        return;
+        console->println(ui(UiText::ERR_CALIBRATION));
+        return false;
     }
 
-    // 입력 검증
-    if (!isValidTemperature(upperTemp) || !isValidTemperature(lowerTemp))
+    SensorConfigRecord *record = ensureSensorConfig(rom);
+    if (!record)
     {
-        Serial.println("❌ 오류: 온도 범위를 벗어났습니다 (-55~125°C)");
-        return;
+        console->println(ui(UiText::ERR_CONFIG_TABLE_FULL));
+        return false;
     }
 
-    if (upperTemp <= lowerTemp)
+    int16_t centi = static_cast<int16_t>(lroundf(offsetC * 100.0f));
+    if (record->calibrationCenti != centi)
     {
-        Serial.println("❌ 오류: 상한값은 하한값보다 커야 합니다");
-        return;
+        record->calibrationCenti = centi;
+        configStore->save();
     }
+    return true;
+}
+
+void SensorController::resetSensorThresholds(uint64_t rom)
+{
+    SensorConfigRecord *record = sensorConfigs.find(rom);
+    if (!record)
+        return;
 
-    // 임계값 설정
-    sensorThresholds[sensorIdx].upperThreshold = upperTemp;
-    sensorThresholds[sensorIdx].lowerThreshold = lowerTemp;
-    sensorThresholds[sensorIdx].isCustomSet = true;
+    if (record->upperThreshold != DEFAULT_UPPER_THRESHOLD || record->lowerThreshold != DEFAULT_LOWER_THRESHOLD || record->isCustomSet)
+    {
+        record->upperThreshold = DEFAULT_UPPER_THRESHOLD;
+        record->lowerThreshold = DEFAULT_LOWER_THRESHOLD;
+        record->isCustomSet = 0;
 
-    // EEPROM에 저장
-    saveSensorThresholds(sensorIdx);
+        saveSensorThresholds(rom);
+    }
 
-    Serial.print("✅ 센서 ");
-    Serial.print(sensorIdx + 1);
-    Serial.print(" 임계값 설정 완료: TH=");
-    Serial.print(upperTemp, 1);
-    Serial.print("°C, TL=");
-    Serial.print(lowerTemp, 1);
-    Serial.println("°C");
+    console->print(ui(UiText::RESET_SENSOR_PREFIX));
+    printSensorAddress(rom);
+    console->println(ui(UiText::THRESHOLDS_RESET));
 }
 
-bool SensorController::isValidTemperature(float temp)
+void SensorController::resetAllThresholds()
 {
-    return (temp >= DS18B20_MIN_TEMP && temp <= DS18B20_MAX_TEMP);
+    console->println();
+    console->println(ui(UiText::RESET_THRESHOLDS_TITLE));
+
+    beginConfigTransaction();
+    for (uint8_t i = 0; i < sensorConfigs.capacity(); i++)
+    {
+        uint64_t rom = sensorConfigs.recordAt(i)->rom;
+        if (rom != 0)
+            resetSensorThresholds(rom);
+    }
+    commitConfigTransaction();
+
+    console->println(ui(UiText::RESET_THRESHOLDS_DONE));
+    console->println();
 }
 
-void SensorController::resetSensorThresholds(int sensorIdx)
+void SensorController::beginConfigTransaction()
 {
-    if (sensorIdx < 0 || sensorIdx >= SENSOR_MAX_COUNT)
-        return;
-
-    sensorThresholds[sensorIdx].upperThreshold = DEFAULT_UPPER_THRESHOLD;
-    sensorThresholds[sensorIdx].lowerThreshold = DEFAULT_LOWER_THRESHOLD;
-    sensorThresholds[sensorIdx].isCustomSet = false;
+    configStore->beginTransaction();
+}
 
-    saveSensorThresholds(sensorIdx);
+bool SensorController::commitConfigTransaction()
+{
+    // 가장 바깥 트랜잭션에서 변경이 있었던 경우에만 기록이 예약됨
+    if (!configStore->commit())
+        return false;
 
-    Serial.print("🔄 센서 ");
-    Serial.print(sensorIdx + 1);
-    Serial.println(" 임계값이 기본값으로 초기화되었습니다");
+    console->println(ui(UiText::EEPROM_BATCH_QUEUED));
+    return true;
 }
 
-void SensorController::resetAllThresholds()
+size_t SensorController::exportConfig(uint8_t *output) const
 {
-    Serial.println();
-    Serial.println("=== 전체 센서 임계값 초기화 시작 ===");
+    return ConfigBlob::encode(configStore->config(), output);
+}
 
-    for (int i = 0; i < SENSOR_MAX_COUNT; i++)
+ConfigBlob::Result SensorController::importConfig(const uint8_t *blob, size_t length, bool &committed)
+{
+    committed = false;
+    ConfigBlob::Result result = ConfigBlob::validate(blob, length);
+    if (result != ConfigBlob::Result::Ok)
+        return result;
+
+    // 블롭 전체를 RAM 섀도우에 적용한 뒤 기록 한 번으로 커밋 (기록 중 전원이 끊기면 이전 레코드 유지)
+    beginConfigTransaction();
+    ConfigBlob::applyTo(blob, configStore->config());
+    sensorConfigs.rebuild();
+    for (int i = 0; i < busCount; ++i)
     {
-        resetSensorThresholds(i);
+        // 블롭에 없는 버스 센서는 기본 레코드로 두고, 분해능은 바로 적용
+        SensorConfigRecord *record = ensureSensorConfig(romFromBytes(busAddresses[i]));
+        if (record)
+            sensors.setResolution(busAddresses[i], record->resolution, true);
     }
+    updateConversionResolution();
+    configStore->save();
+    committed = commitConfigTransaction();
+
+    // 출력 형식/변경분 설정이 바뀌었을 수 있으므로 다음 주기는 전체 출력
+    csvHeaderPending = true;
+    romMapPending = true;
+    keyframePending = true;
+    dashboardRedrawPending = true;
+    buildSensorRows();
+    return result;
+}
 
-    Serial.println("=== 전체 센서 임계값 초기화 완료 ===");
-    Serial.println();
+bool SensorController::flushConfig()
+{
+    // 백그라운드 기록 대기열을 즉시 비움
+    bool ok = configStore->flush();
+    if (ok)
+    {
+        console->print(ui(UiText::EEPROM_WRITTEN));
+        console->print(configStore->getSequence());
+        console->println(")");
+    }
+    else
+    {
+        console->println(ui(UiText::ERR_CONFIG_SAVE));
+    }
+    return ok;
 }
 
 // 센서별 임계값을 사용한 상태 확인 메서드들
-const char *SensorController::getUpperState(int sensorIdx, float temp)
+const char *SensorController::getUpperState(uint64_t rom, float temp)
 {
     if (temp == DEVICE_DISCONNECTED_C)
         return "-";
 
-    float threshold = getUpperThreshold(sensorIdx);
+    float threshold = getUpperThreshold(rom);
     return (temp > threshold) ? "초과" : "정상";
 }
 
-const char *SensorController::getLowerState(int sensorIdx, float temp)
+const char *SensorController::getLowerState(uint64_t rom, float temp)
 {
     if (temp == DEVICE_DISCONNECTED_C)
         return "-";
 
-    float threshold = getLowerThreshold(sensorIdx);
+    float threshold = getLowerThreshold(rom);
     return (temp < threshold) ? "초과" : "정상";
 }
 
-const char *SensorController::getSensorStatus(int sensorIdx, float temp)
+const char *SensorController::getSensorStatus(uint64_t rom, float temp)
 {
     if (temp == DEVICE_DISCONNECTED_C)
         return "오류";
 
-    float upperThreshold = getUpperThreshold(sensorIdx);
-    float lowerThreshold = getLowerThreshold(sensorIdx);
+    float upperThreshold = getUpperThreshold(rom);
+    float lowerThreshold = getLowerThreshold(rom);
 
     if (temp > upperThreshold || temp < lowerThreshold)
     {
@@ -641,71 +1916,56 @@ const char *SensorController::getSensorStatus(int sensorIdx, float temp)
 
 void SensorController::initializeMeasurementInterval()
 {
-    Serial.print("EEPROM 측정 주기 로드 중");
-
-    // 기본값으로 초기화
-    measurementInterval = DEFAULT_MEASUREMENT_INTERVAL;
-
-    // EEPROM에서 로드 시도
-    loadMeasurementInterval();
-
-    Serial.print(".");
-    Serial.println(" 완료");
-
-    Serial.print("현재 측정 주기: ");
-    Serial.println(formatInterval(measurementInterval));
-}
-
-void SensorController::loadMeasurementInterval()
-{
-    unsigned long storedInterval;
-    EEPROM.get(EEPROM_INTERVAL_ADDR, storedInterval);
+    SystemConfig &cfg = configStore->config();
 
-    // 유효성 검사
-    if (isValidMeasurementInterval(storedInterval))
-    {
-        measurementInterval = storedInterval;
-    }
-    else
+    // 유효성 검사 (유효하지 않은 값이면 기본값 사용 및 저장)
+    if (!isValidMeasurementInterval(cfg.measurementInterval))
     {
-        // 유효하지 않은 값이면 기본값 사용 및 저장
-        measurementInterval = DEFAULT_MEASUREMENT_INTERVAL;
+        cfg.measurementInterval = DEFAULT_MEASUREMENT_INTERVAL;
         saveMeasurementInterval();
     }
+
+    console->print(ui(UiText::CURRENT_INTERVAL));
+    printInterval(cfg.measurementInterval);
 }
 
 void SensorController::saveMeasurementInterval()
 {
-    // 값이 변경된 경우에만 EEPROM 쓰기 (수명 연장)
-    unsigned long currentInterval;
-    EEPROM.get(EEPROM_INTERVAL_ADDR, currentInterval);
-
-    if (currentInterval != measurementInterval)
+    if (!configStore->save())
     {
-        EEPROM.put(EEPROM_INTERVAL_ADDR, measurementInterval);
-        Serial.print("💾 EEPROM 저장 - 측정 주기: ");
-        Serial.println(formatInterval(measurementInterval));
+        console->println(ui(UiText::ERR_CONFIG_SAVE));
+        return;
     }
+
+    if (configStore->inTransaction())
+        return;
+
+    console->print(ui(UiText::EEPROM_SAVE_INTERVAL));
+    printInterval(configStore->config().measurementInterval);
 }
 
 unsigned long SensorController::getMeasurementInterval()
 {
-    return measurementInterval;
+    return configStore->config().measurementInterval;
 }
 
 void SensorController::setMeasurementInterval(unsigned long intervalMs)
 {
     if (!isValidMeasurementInterval(intervalMs))
     {
-        Serial.println("❌ 오류: 측정 주기 범위를 벗어났습니다");
+        console->println(ui(UiText::ERR_INTERVAL_RANGE));
         return;
     }
 
-    measurementInterval = intervalMs;
-    saveMeasurementInterval();
+    // 값이 변경된 경우에만 저장 (수명 연장)
+    if (configStore->config().measurementInterval != intervalMs)
+    {
+        configStore->config().measurementInterval = intervalMs;
+        saveMeasurementInterval();
+    }
 
-    Serial.print("✅ 측정 주기 설정 완료: ");
-    Serial.println(formatInterval(measurementInterval));
+    console->print(ui(UiText::INTERVAL_SET));
+    printInterval(intervalMs);
 }
 
 bool SensorController::isValidMeasurementInterval(unsigned long intervalMs)
@@ -713,94 +1973,9 @@ bool SensorController::isValidMeasurementInterval(unsigned long intervalMs)
     return (intervalMs >= MIN_MEASUREMENT_INTERVAL && intervalMs <= MAX_MEASUREMENT_INTERVAL);
 }
 
-String SensorController::formatInterval(unsigned long intervalMs)
+void SensorController::printInterval(unsigned long intervalMs)
 {
-    String result = "";
-
-    // 밀리초를 초로 변환
-    unsigned long totalSeconds = intervalMs / 1000;
-
-    if (totalSeconds >= 86400)
-    { // 1일 이상
-        unsigned long days = totalSeconds / 86400;
-        unsigned long remainingSeconds = totalSeconds % 86400;
-        result += String(days) + "일";
-
-        if (remainingSeconds >= 3600)
-        { // 1시간 이상
-            unsigned long hours = remainingSeconds / 3600;
-            remainingSeconds %= 3600;
-            result += " " + String(hours) + "시간";
-
-            if (remainingSeconds >= 60)
-            { // 1분 이상
-                unsigned long minutes = remainingSeconds / 60;
-                remainingSeconds %= 60;
-                result += " " + String(minutes) + "분";
-
-                if (remainingSeconds > 0)
-                {
-                    result += " " + String(remainingSeconds) + "초";
-                }
-            }
-            else if (remainingSeconds > 0)
-            {
-                result += " " + String(remainingSeconds) + "초";
-            }
-        }
-        else if (remainingSeconds >= 60)
-        { // 1분 이상
-            unsigned long minutes = remainingSeconds / 60;
-            remainingSeconds %= 60;
-            result += " " + String(minutes) + "분";
-
-            if (remainingSeconds > 0)
-            {
-                result += " " + String(remainingSeconds) + "초";
-            }
-        }
-        else if (remainingSeconds > 0)
-        {
-            result += " " + String(remainingSeconds) + "초";
-        }
-    }
-    else if (totalSeconds >= 3600)
-    { // 1시간 이상
-        unsigned long hours = totalSeconds / 3600;
-        unsigned long remainingSeconds = totalSeconds % 3600;
-        result += String(hours) + "시간";
-
-        if (remainingSeconds >= 60)
-        { // 1분 이상
-            unsigned long minutes = remainingSeconds / 60;
-            remainingSeconds %= 60;
-            result += " " + String(minutes) + "분";
-
-            if (remainingSeconds > 0)
-            {
-                result += " " + String(remainingSeconds) + "초";
-            }
-        }
-        else if (remainingSeconds > 0)
-        {
-            result += " " + String(remainingSeconds) + "초";
-        }
-    }
-    else if (totalSeconds >= 60)
-    { // 1분 이상
-        unsigned long minutes = totalSeconds / 60;
-        unsigned long remainingSeconds = totalSeconds % 60;
-        result += String(minutes) + "분";
-
-        if (remainingSeconds > 0)
-        {
-            result += " " + String(remainingSeconds) + "초";
-        }
-    }
-    else
-    { // 1분 미만
-        result += String(totalSeconds) + "초";
-    }
-
-    return result;
-}
\ No newline at end of file
+    LineBuffer line;
+    line.appendInterval(intervalMs).appendLineEnd();
+    console->write(line.data(), line.length());
+}
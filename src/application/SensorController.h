@@ -1,74 +1,133 @@
 #pragma once
 #include <Arduino.h>
 #include <DallasTemperature.h>
-#include <EEPROM.h>
-#include <vector>
+#include "../domain/ConfigBlob.h"
+#include "../domain/IConfigStore.h"
+#include "../domain/LineBuffer.h"
+#include "../domain/SensorConfigTable.h"
 #include "../domain/ITemperatureSensor.h"
 #include "../domain/SensorStatus.h"
+#include "../domain/WarmStartCache.h"
 
 constexpr int SENSOR_MAX_COUNT = 8;
+constexpr uint8_t TELEMETRY_ROM_MAP_PERIOD = 16; // 바이너리 모드 ROM 대응표 재전송 주기 (프레임)
+constexpr uint8_t DASHBOARD_CELL_COUNT = 8;      // 대시보드 행당 갱신 칸 (번호 제외)
 
-// DS18B20 온도 범위 상수
-constexpr float DS18B20_MIN_TEMP = -55.0f;
-constexpr float DS18B20_MAX_TEMP = 125.0f;
-constexpr float DEFAULT_UPPER_THRESHOLD = 30.0f;
-constexpr float DEFAULT_LOWER_THRESHOLD = 20.0f;
-
-// 측정 주기 관련 상수
-constexpr unsigned long MIN_MEASUREMENT_INTERVAL = 10000;      // 10초 (밀리초)
-constexpr unsigned long MAX_MEASUREMENT_INTERVAL = 2592000000; // 30일 (밀리초)
-constexpr unsigned long DEFAULT_MEASUREMENT_INTERVAL = 15000;  // 15초 (밀리초)
-
-// EEPROM 주소 할당
-constexpr int EEPROM_BASE_ADDR = 0;
-constexpr int EEPROM_SIZE_PER_SENSOR = 8; // float(4) + float(4) = 8 bytes
-constexpr int EEPROM_INTERVAL_ADDR = 64;  // 측정 주기 저장 주소 (unsigned long 4 bytes)
-
-struct SensorThresholds {
-    float upperThreshold = DEFAULT_UPPER_THRESHOLD;  // TH (상한)
-    float lowerThreshold = DEFAULT_LOWER_THRESHOLD;  // TL (하한)
-    bool isCustomSet = false;                        // 사용자 설정 여부
-};
+static_assert(SENSOR_MAX_COUNT <= CONFIG_SENSOR_SLOTS, "config record must hold every sensor slot");
 
 struct SensorRowInfo
 {
     int idx;
-    int logicalId;
+    int logicalId; // 1~SENSOR_MAX_COUNT, 0: 미할당 (범위 밖 ID 포함, rowLogicalId()에서만 결정)
+    uint64_t rom;
     DeviceAddress addr;
     float temp;
     bool connected;
+    bool stale; // 리셋 이전 캐시 값 (새 측정 전)
+};
+
+// 마지막 상태 테이블 출력 비용 (변환 대기 제외, 'perf' 명령으로 조회)
+struct TableRenderStats
+{
+    uint32_t cycles;
+    uint32_t bytes;
+    uint16_t lines;
+    uint16_t truncatedLines;
+};
+
+// 변경분 출력 판단용: 마지막으로 출력한 센서 값 (ROM 주소로 식별)
+struct ReportedSensorState
+{
+    uint64_t rom;
+    int32_t tempCenti;
+    uint8_t status; // 0 정상, 1 상한 초과, 2 하한 미만, 3 측정 오류
 };
 
 class SensorController
 {
 public:
-    SensorController();
+    explicit SensorController(IConfigStore *store);
+
+    // 메시지 출력 대상 (기본 Serial, 빠른 부팅 중에는 지연 출력 버퍼)
+    void setConsole(Print *output) { console = output; }
+    Print *getConsole() const { return console; }
+    void setAlarmConsole(Print *output) { alarmConsole = output; } // 임계값 경보 줄 (우선 전송)
+
+    // 버스 센서 목록 (idx는 목록 내 0-based 인덱스)
+    // beginSensors(): 저장된 ROM 목록을 MATCH ROM으로 확인해 바로 측정 시작,
+    // 목록이 없거나 확인에 실패하면 전체 검색(sensors.begin())으로 대체
+    void beginSensors();
+    void updateSensorDiscovery(); // loop()에서 호출, 1회당 OneWire 검색 1단계 수행
+    bool isDiscoveryActive() const { return discoveryActive; }
+    unsigned long getFirstReadingMs() const { return firstReadingMs; } // 0: 아직 유효 측정 없음
 
-    // 센서 논리 ID 관리
+    // 변환 요청만 보내고 완료 여부는 loop()에서 확인 (setup()의 첫 변환, 주기 측정)
+    // 완료 전에 updateSensorRows()가 불리면 남은 변환 시간만 기다린 뒤 그 결과를 사용
+    void startConversion();
+    bool isConversionReady();
+    bool isConversionPending() const { return conversionPending; }
+    int getSensorCount() const { return busCount; }
+    uint64_t getSensorRom(int idx) const;
+    bool getDisplayRowRom(int displayNum, uint64_t &rom) const; // displayNum: 표시 행 번호 1~8
+
+    // 센서 논리 ID 관리 (ROM별 설정 레코드에 저장)
     uint8_t getSensorLogicalId(int idx);
     void setSensorLogicalId(int idx, uint8_t newId);
     bool isIdDuplicated(int newId, int exceptIdx = -1);
     void assignIDsByAddress();
     void resetAllSensorIds(); // 전체 ID 초기화
     
-    // 센서 임계값 관리 (sensorIdx는 표시 행 번호 기반 0-7 인덱스)
-    void initializeThresholds(); // EEPROM에서 임계값 로드
-    float getUpperThreshold(int sensorIdx);
-    float getLowerThreshold(int sensorIdx);
-    void setThresholds(int sensorIdx, float upperTemp, float lowerTemp);
+    // 센서 임계값 관리 (ROM 주소로 식별)
+    void initializeThresholds(); // 설정 저장소에서 임계값 로드
+    float getUpperThreshold(uint64_t rom);
+    float getLowerThreshold(uint64_t rom);
+    bool setThresholds(uint64_t rom, float upperTemp, float lowerTemp);
     bool isValidTemperature(float temp);
-    void resetSensorThresholds(int sensorIdx); // 개별 센서 임계값 초기화
+    void resetSensorThresholds(uint64_t rom); // 개별 센서 임계값 초기화
     void resetAllThresholds(); // 모든 센서 임계값 초기화
+
+    // 센서별 분해능/보정값
+    bool setSensorResolution(uint64_t rom, uint8_t bits);
+    bool setCalibrationOffset(uint64_t rom, float offsetC);
+
+    // 설정 일괄 변경 (begin~commit 사이의 변경은 한 번의 EEPROM 기록으로 저장)
+    void beginConfigTransaction();
+    bool commitConfigTransaction();
+    bool flushConfig(); // 예약된 설정 기록을 즉시 완료
+
+    // 설정 블롭 내보내기/가져오기 (ConfigBlob.h 형식, 가져오기는 검사 통과 시 기록 한 번으로 적용)
+    size_t exportConfig(uint8_t *output) const; // output은 ConfigBlob::MAX_SIZE 이상
+    ConfigBlob::Result importConfig(const uint8_t *blob, size_t length, bool &committed);
     
     // 측정 주기 관리
-    void initializeMeasurementInterval(); // EEPROM에서 측정 주기 로드
+    void initializeMeasurementInterval(); // 로드된 측정 주기 검증
     unsigned long getMeasurementInterval(); // 현재 측정 주기 조회
     void setMeasurementInterval(unsigned long intervalMs); // 측정 주기 설정
     bool isValidMeasurementInterval(unsigned long intervalMs); // 측정 주기 유효성 검증
-    String formatInterval(unsigned long intervalMs); // 측정 주기를 읽기 쉬운 형태로 변환
 
     // 센서 상태 테이블 관리
-    void printSensorStatusTable();
+    void printSensorStatusTable(); // 대시보드 모드에서는 화면 전체를 다시 그림
+    bool printWarmStartTable(); // 첫 변환 전 리셋 이전 값을 stale 표시로 1회 출력
+
+    // 주기 출력 (설정된 형식: 테이블 / CSV / JSON Lines / 바이너리 / 대시보드)
+    void printSensorReport();
+    OutputMode getOutputMode() const;
+    void setOutputMode(OutputMode mode);
+    static const char *getOutputModeName(OutputMode mode);
+    const TableRenderStats &getRenderStats() const { return renderStats; }
+
+    // 변경분 출력 (데드밴드 초과/상태/연결 변화만, 일정 주기마다 전체 키프레임)
+    bool isDeltaReporting() const { return configStore->config().deltaReporting != 0; }
+    void setDeltaReporting(bool enabled);
+    uint16_t getDeltaDeadbandCenti() const { return configStore->config().deltaDeadbandCenti; }
+    bool setDeltaDeadbandCenti(uint16_t centi);
+    uint8_t getKeyframeInterval() const { return configStore->config().keyframeInterval; }
+    bool setKeyframeInterval(uint8_t reports);
+
+    // 리셋 간 유지되는 측정 캐시 (.noinit)
+    bool restoreWarmStart(); // 부팅 시 1회 호출, 유효한 캐시가 있으면 true
+    const WarmStartEntry *getWarmStartEntry(uint64_t rom) const { return warmCache.find(rom); }
+    uint32_t getBootGeneration() const { return warmCache.generation; }
     void updateSensorRows();
     const SensorRowInfo *getSortedSensorRows() const { return g_sortedSensorRows; }
 
@@ -77,32 +136,98 @@ public:
     const char *getLowerState(float temp);
     const char *getSensorStatus(float temp);
     
-    // 새로운 임계값 관리 (센서별 임계값, sensorIdx는 표시 행 번호 기반 0-7 인덱스)
-    const char *getUpperState(int sensorIdx, float temp);
-    const char *getLowerState(int sensorIdx, float temp);
-    const char *getSensorStatus(int sensorIdx, float temp);
+    // 새로운 임계값 관리 (센서별 임계값, ROM 주소로 조회)
+    const char *getUpperState(uint64_t rom, float temp);
+    const char *getLowerState(uint64_t rom, float temp);
+    const char *getSensorStatus(uint64_t rom, float temp);
 
 private:
     static SensorRowInfo g_sortedSensorRows[SENSOR_MAX_COUNT];
-    SensorThresholds sensorThresholds[SENSOR_MAX_COUNT]; // 센서별 임계값 저장
-    unsigned long measurementInterval; // 현재 측정 주기 (밀리초)
+    static WarmStartCache warmCache;
+    IConfigStore *configStore; // 임계값/측정 주기 RAM 섀도우 및 영구 저장
+    Print *console;
+    Print *alarmConsole;
+    SensorConfigTable sensorConfigs; // ROM → 센서 설정 레코드 (O(1) 조회)
+
+    // 버스 센서 목록 (라이브러리 인덱스 조회 대신 캐시된 ROM 주소 사용)
+    DeviceAddress busAddresses[SENSOR_MAX_COUNT];
+    int busCount;
+
+    // 백그라운드 전체 검색 상태
+    DeviceAddress discoveredAddresses[SENSOR_MAX_COUNT];
+    int discoveredCount;
+    bool discoveryActive;
+    bool fastBootUsed;
+    unsigned long firstReadingMs;
+    bool conversionPending;
+    unsigned long conversionStartMs;
+    uint8_t conversionResolution; // 버스 센서 중 최대 분해능 (변환 대기 시간 기준)
+
+    bool warmTablePending;
+    bool csvHeaderPending;
+    uint16_t telemetrySequence; // 바이너리 프레임 순번 (수신 측 누락 검출)
+    uint8_t framesSinceRomMap;
+    bool romMapPending;         // 다음 바이너리 출력 전에 슬롯 → ROM 대응표 전송
+
+    // 변경분 출력 상태
+    ReportedSensorState reportedStates[SENSOR_MAX_COUNT];
+    uint8_t reportedCount;
+    bool rowReported[SENSOR_MAX_COUNT]; // 이번 출력에 포함할 정렬 행
+    uint64_t removedRoms[SENSOR_MAX_COUNT]; // 지난 출력 이후 사라진 센서
+    uint8_t removedCount;
+    bool deltaFrame; // 이번 출력이 변경분만 포함하는지
+    bool keyframePending;
+    uint8_t reportsSinceKeyframe;
+
+    // 대시보드 상태: 칸별 내용의 CRC만 보관 (RAM 절약)
+    uint16_t dashboardCells[SENSOR_MAX_COUNT][DASHBOARD_CELL_COUNT];
+    bool dashboardRedrawPending;
+    uint32_t dashboardUpdates;
+    TableRenderStats renderStats;
+
+    bool restoreKnownRoster();
+    void applySensorRoster(const DeviceAddress *addrs, int count);
+    bool isRosterChanged(const DeviceAddress *addrs, int count) const;
+    void updateConversionResolution(); // 로스터/분해능 변경 후 호출
+    void saveKnownRoms();
     
     void printSensorAddress(const DeviceAddress &addr);
-    void printSensorRow(int idx, int id, const DeviceAddress &addr, float temp);
-    
-    // EEPROM 관련 private 메서드
-    void loadSensorThresholds(int sensorIdx);
-    void saveSensorThresholds(int sensorIdx);
-    void saveSensorThresholds(int sensorIdx, bool verbose);
-    int getEEPROMAddress(int sensorIdx);
+    void printSensorAddress(uint64_t rom);
+    void printThresholdPair(float upper, float lower); // "TH=xx.x°C, TL=xx.x°C" + 줄바꿈
+    void printInterval(unsigned long intervalMs);      // 측정 주기를 읽기 쉬운 형태로 출력 + 줄바꿈
+    void printSensorRow(const SensorRowInfo &row, int id);
+    void printSensorTable();
+    void printReportRows(); // 현재 행을 설정된 형식으로 출력 (측정 없음)
+    void printCsvReport();
+    void printJsonReport();
+    void printBinaryReport();
+    void printDashboard();
+    void drawDashboardFrame(LineBuffer &out);
+    void appendDashboardCell(LineBuffer &out, uint8_t screenRow, uint8_t cell, const char *text, uint16_t &changedCells);
+    void flushDashboard(LineBuffer &out);
+    bool selectReportRows(); // 출력할 행 선택, 출력할 내용이 없으면 false
+    bool isRowReported(int sortedIdx) const { return !deltaFrame || rowReported[sortedIdx]; }
+    void printRemovedRow(uint64_t rom);
+    uint8_t reportStatusOf(const SensorRowInfo &row);
+    void sendTelemetryRomMap();
+    void writeTelemetryFrame(uint8_t type, const uint8_t *body, uint8_t count, size_t bodySize);
+    void writeLine(LineBuffer &line); // 줄바꿈 추가 후 write() 1회
+    void writeLine(const char *text);
+    void storeWarmStart();
+    void printAlarmTransition(const SensorRowInfo &row, uint8_t previousFlags, uint8_t flags);
     
-    // 측정 주기 EEPROM 관련 메서드
-    void loadMeasurementInterval();
+    // 설정 저장 관련 private 메서드
+    SensorConfigRecord *ensureSensorConfig(uint64_t rom);
+    void adoptLegacySettings(SensorConfigRecord &record, const DeviceAddress &addr);
+    void migrateLegacyRowThresholds();
+    bool sanitizeThresholds(float &upper, float &lower);
+    void saveSensorThresholds(uint64_t rom);
     void saveMeasurementInterval();
     
     // Helper methods for updateSensorRows
-    void collectSensorData(std::vector<SensorRowInfo>& sensorRows);
-    SensorRowInfo createSensorRowInfo(int idx, int deviceCount);
-    void sortSensorRows(std::vector<SensorRowInfo>& sensorRows);
-    void storeSortedResults(const std::vector<SensorRowInfo>& sensorRows);
+    void buildSensorRows(); // 온도 변환 요청 없이 목록/정렬만 갱신
+    void collectSensorData(SensorRowInfo *sensorRows);
+    SensorRowInfo createSensorRowInfo(int idx);
+    void sortSensorRows(SensorRowInfo *sensorRows);
+    void storeSortedResults(const SensorRowInfo *sensorRows);
 };
@@ -1,56 +1,48 @@
 #include <Arduino.h>
-#include <vector>
 #include "SensorMenuHandler.h"
 #include "SensorController.h"
+#include "../domain/TextParse.h"
+#include "../domain/UiText.h"
+#include "../infrastructure/SerialTxQueue.h"
 
 extern SensorController sensorController;
+extern SerialTxQueue serialOut;
 
 SensorMenuHandler::SensorMenuHandler()
 {
     // 생성자
 }
 
-std::vector<int> SensorMenuHandler::parseSensorIndices(const String &input)
+SensorIndexList SensorMenuHandler::parseSensorIndices(std::string_view input)
 {
-    std::vector<int> indices;
-    bool used[9] = {false}; // 1~8만 사용
-    int len = input.length();
+    int parsed[SENSOR_MAX_COUNT];
+    uint8_t count = TextParse::parseSensorIndices(input, parsed, SENSOR_MAX_COUNT);
 
-    for (int i = 0; i < len; ++i)
-    {
-        char c = input.charAt(i);
-        if (c >= '1' && c <= '8')
-        {
-            int idx = c - '0';
-            if (!used[idx])
-            {
-                indices.push_back(idx);
-                used[idx] = true;
-            }
-        }
-    }
+    SensorIndexList indices;
+    for (uint8_t i = 0; i < count; ++i)
+        indices.push_back(parsed[i]);
     return indices;
 }
 
-bool SensorMenuHandler::validateSensorIndices(const std::vector<int> &indices)
+bool SensorMenuHandler::validateSensorIndices(const SensorIndexList &indices)
 {
     if (indices.empty())
     {
-        Serial.println("오류: 유효한 센서 번호가 없습니다.");
+        serialOut.println(ui(UiText::ERR_NO_VALID_SENSOR));
         return false;
     }
 
     if (indices.size() > 8)
     {
-        Serial.println("오류: 너무 많은 센서가 선택되었습니다.");
+        serialOut.println(ui(UiText::ERR_TOO_MANY_SENSORS));
         return false;
     }
 
     return true;
 }
 
-bool SensorMenuHandler::processSensorSelection(const std::vector<int> &indices,
-                                               std::vector<int> &selectedIndices,
+bool SensorMenuHandler::processSensorSelection(const SensorIndexList &indices,
+                                               SensorIndexList &selectedIndices,
                                                int &currentSensorIdx)
 {
     if (!validateSensorIndices(indices))
@@ -61,14 +53,14 @@ bool SensorMenuHandler::processSensorSelection(const std::vector<int> &indices,
     selectedIndices = indices;
     currentSensorIdx = 0;
 
-    Serial.print("선택된 센서: ");
+    serialOut.print(ui(UiText::SELECTED_SENSORS));
     for (size_t i = 0; i < indices.size(); ++i)
     {
-        Serial.print(indices[i]);
+        serialOut.print(indices[i]);
         if (i < indices.size() - 1)
-            Serial.print(", ");
+            serialOut.print(", ");
     }
-    Serial.println();
+    serialOut.println();
 
     return true;
 }
@@ -77,51 +69,51 @@ bool SensorMenuHandler::processSensorIdChange(int sensorIdx, int newId)
 {
     if (newId < 1 || newId > 8)
     {
-        Serial.println("오류: ID는 1~8 사이여야 합니다.");
+        serialOut.println(ui(UiText::ERR_ID_RANGE));
         return false;
     }
 
     if (isIdDuplicated(newId, sensorIdx - 1))
     {
-        Serial.println("오류: 이미 사용 중인 ID입니다.");
+        serialOut.println(ui(UiText::ERR_ID_IN_USE));
         return false;
     }
 
     sensorController.setSensorLogicalId(sensorIdx - 1, newId);
-    Serial.print("센서 ");
-    Serial.print(sensorIdx);
-    Serial.print("의 ID를 ");
-    Serial.print(newId);
-    Serial.println("로 변경했습니다.");
+    serialOut.print(ui(UiText::SENSOR_PREFIX));
+    serialOut.print(sensorIdx);
+    serialOut.print(ui(UiText::ID_CHANGED_TO));
+    serialOut.print(newId);
+    serialOut.println(ui(UiText::ID_CHANGED_SUFFIX));
 
     return true;
 }
 
 void SensorMenuHandler::printSensorIdMenu()
 {
-    Serial.println();
-    Serial.println("--- 센서 ID 조정 메뉴 ---");
-    Serial.println("1. 개별 센서 ID 변경");
-    Serial.println("2. 복수의 센서 ID 변경");
-    Serial.println("3. 주소순 자동 ID 할당");
-    Serial.println("4. 전체 ID 초기화");
-    Serial.println("5. 이전 메뉴 이동");
-    Serial.println("6. 상태창으로 돌아가기");
-    Serial.print("메뉴 번호를 입력하세요: ");
+    serialOut.println();
+    serialOut.println(ui(UiText::ID_MENU_TITLE));
+    serialOut.println(ui(UiText::ID_MENU_SINGLE));
+    serialOut.println(ui(UiText::ID_MENU_MULTI));
+    serialOut.println(ui(UiText::ID_MENU_AUTO));
+    serialOut.println(ui(UiText::ID_MENU_RESET));
+    serialOut.println(ui(UiText::ID_MENU_BACK));
+    serialOut.println(ui(UiText::ID_MENU_STATUS));
+    serialOut.print(ui(UiText::PROMPT_MENU_NUMBER));
 }
 
 void SensorMenuHandler::printSensorSelectionPrompt()
 {
-    Serial.println();
-    Serial.println("변경할 센서 번호를 입력하세요 (예: 1,3,5 또는 135):");
-    Serial.print("> ");
+    serialOut.println();
+    serialOut.println(ui(UiText::PROMPT_SENSOR_LIST));
+    serialOut.print("> ");
 }
 
 void SensorMenuHandler::printIdInputPrompt(int sensorIdx)
 {
-    Serial.print("센서 ");
-    Serial.print(sensorIdx);
-    Serial.print("의 새 ID (1-8)를 입력하세요: ");
+    serialOut.print(ui(UiText::SENSOR_PREFIX));
+    serialOut.print(sensorIdx);
+    serialOut.print(ui(UiText::PROMPT_NEW_ID_SHORT));
 }
 
 bool SensorMenuHandler::isIdDuplicated(int newId, int exceptIdx)
@@ -132,9 +124,9 @@ bool SensorMenuHandler::isIdDuplicated(int newId, int exceptIdx)
 void SensorMenuHandler::printSensorInfo(int idx)
 {
     // 센서 정보 출력 로직
-    Serial.print("센서 ");
-    Serial.print(idx);
-    Serial.print(" (현재 ID: ");
-    Serial.print(sensorController.getSensorLogicalId(idx - 1));
-    Serial.println(")");
+    serialOut.print(ui(UiText::SENSOR_PREFIX));
+    serialOut.print(idx);
+    serialOut.print(ui(UiText::CURRENT_ID_PREFIX));
+    serialOut.print(sensorController.getSensorLogicalId(idx - 1));
+    serialOut.println(")");
 }
\ No newline at end of file
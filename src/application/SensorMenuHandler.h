@@ -1,6 +1,11 @@
 #pragma once
 #include <Arduino.h>
-#include <vector>
+#include <string_view>
+#include "SensorController.h"
+#include "../domain/StaticVector.h"
+
+// 선택한 센서 표시 번호 목록 (1~8, 힙 할당 없음)
+using SensorIndexList = StaticVector<int, SENSOR_MAX_COUNT>;
 
 // 센서 관련 메뉴 처리를 위한 클래스
 class SensorMenuHandler
@@ -9,12 +14,12 @@ public:
     SensorMenuHandler();
     
     // 센서 인덱스 파싱 및 검증
-    static std::vector<int> parseSensorIndices(const String& input);
-    static bool validateSensorIndices(const std::vector<int>& indices);
+    static SensorIndexList parseSensorIndices(std::string_view input);
+    static bool validateSensorIndices(const SensorIndexList& indices);
     
     // 센서 선택 처리
-    bool processSensorSelection(const std::vector<int>& indices, 
-                               std::vector<int>& selectedIndices,
+    bool processSensorSelection(const SensorIndexList& indices, 
+                               SensorIndexList& selectedIndices,
                                int& currentSensorIdx);
     
     // 센서 ID 변경 처리
@@ -0,0 +1,26 @@
+#pragma once
+#include <DallasTemperature.h>
+
+// 기계 판독용 상태 코드 (표시용 한글 문자열과 별도)
+// CSV/JSON 보고와 콘솔 "sensor" 자료 줄이 같은 코드를 쓰도록 한곳에 둔다.
+
+inline const char *upperStateCode(float temp, float upper)
+{
+    if (temp == DEVICE_DISCONNECTED_C)
+        return "na";
+    return (temp > upper) ? "over" : "ok";
+}
+
+inline const char *lowerStateCode(float temp, float lower)
+{
+    if (temp == DEVICE_DISCONNECTED_C)
+        return "na";
+    return (temp < lower) ? "under" : "ok";
+}
+
+inline const char *statusCode(float temp, float upper, float lower)
+{
+    if (temp == DEVICE_DISCONNECTED_C)
+        return "error";
+    return (temp > upper || temp < lower) ? "warn" : "ok";
+}
@@ -8,10 +8,7 @@ SystemMonitorService::SystemMonitorService(IMemoryManager *memMgr, ILogger *log)
 
 void SystemMonitorService::initialize()
 {
-    if (logger)
-    {
-        logger->info("System Monitor Service initialized");
-    }
+    LOG_INFO(logger, "System Monitor Service initialized");
     lastCheckTime = millis();
 }
 
@@ -55,10 +52,7 @@ bool SystemMonitorService::isSystemHealthy() const
 
 void SystemMonitorService::handleMemoryWarning()
 {
-    if (logger)
-    {
-        logger->warning("Low memory detected - optimizing");
-    }
+    LOG_WARNING(logger, "Low memory detected - optimizing");
 
     if (memoryManager)
     {
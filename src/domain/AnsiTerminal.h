@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "LineBuffer.h"
+
+/**
+ * @brief ANSI 터미널 제어 시퀀스와 표시 폭 계산
+ *
+ * 대시보드처럼 화면의 고정 위치를 다시 쓰는 출력에서 사용한다.
+ * 표시 폭은 한글 음절/이모지를 2칸, 그 밖의 문자를 1칸으로 계산한다.
+ */
+namespace AnsiTerminal
+{
+constexpr const char *CLEAR_SCREEN = "\x1B[2J\x1B[H";
+
+// ESC[row;colH (1부터 시작)
+inline LineBuffer &appendCursorTo(LineBuffer &out, uint8_t row, uint8_t col)
+{
+    return out.append("\x1B[").appendInt(row).append(';').appendInt(col).append('H');
+}
+
+// UTF-8 문자열의 터미널 표시 폭
+inline uint8_t displayWidth(const char *text)
+{
+    uint8_t width = 0;
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(text);
+    while (*p)
+    {
+        if (*p < 0x80)
+        {
+            ++width;
+            ++p;
+        }
+        else if ((*p & 0xE0) == 0xC0)
+        {
+            ++width; // 2바이트: '°' 등 라틴 문자
+            p += 2;
+        }
+        else if ((*p & 0xF0) == 0xE0)
+        {
+            // 3바이트: 한글 음절(U+AC00~U+D7A3)과 CJK는 2칸
+            uint16_t code = static_cast<uint16_t>(((p[0] & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F));
+            width += (code >= 0x1100 && code < 0x1200) || (code >= 0x2E80 && code < 0xA4D0) ||
+                             (code >= 0xAC00 && code < 0xD7A4) || (code >= 0xF900 && code < 0xFB00)
+                         ? 2
+                         : 1;
+            p += 3;
+        }
+        else
+        {
+            width += 2; // 4바이트: 이모지
+            p += 4;
+        }
+    }
+    return width;
+}
+} // namespace AnsiTerminal
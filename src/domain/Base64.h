@@ -0,0 +1,95 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Base64 인코딩/디코딩 (RFC 4648 표준 알파벳, '=' 채움)
+ *
+ * 설정 내보내기처럼 바이너리를 텍스트 명령 줄로 옮길 때 쓴다.
+ * 3바이트마다 4글자로 바뀌므로 3의 배수 단위로 나눠 인코딩한 조각은 그대로 이어 붙일 수 있다.
+ */
+constexpr size_t base64EncodedLength(size_t length)
+{
+    return (length + 2) / 3 * 4;
+}
+
+// 반환값: 출력 글자 수 (끝 '\0' 미포함, output은 base64EncodedLength(length) + 1 이상)
+inline size_t base64Encode(const uint8_t *input, size_t length, char *output)
+{
+    static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    size_t write = 0;
+
+    for (size_t read = 0; read < length; read += 3)
+    {
+        size_t remaining = length - read;
+        uint32_t group = static_cast<uint32_t>(input[read]) << 16;
+        if (remaining > 1)
+            group |= static_cast<uint32_t>(input[read + 1]) << 8;
+        if (remaining > 2)
+            group |= input[read + 2];
+
+        output[write++] = ALPHABET[(group >> 18) & 0x3F];
+        output[write++] = ALPHABET[(group >> 12) & 0x3F];
+        output[write++] = remaining > 1 ? ALPHABET[(group >> 6) & 0x3F] : '=';
+        output[write++] = remaining > 2 ? ALPHABET[group & 0x3F] : '=';
+    }
+    output[write] = '\0';
+    return write;
+}
+
+inline int base64Value(char c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+    if (c == '+')
+        return 62;
+    if (c == '/')
+        return 63;
+    return -1;
+}
+
+// 반환값: 디코딩된 길이, 형식 오류(길이가 4의 배수 아님, 알파벳 밖 글자, 용량 초과)면 -1
+inline int base64Decode(const char *input, size_t length, uint8_t *output, size_t capacity)
+{
+    if (length % 4 != 0)
+        return -1;
+
+    size_t write = 0;
+    for (size_t read = 0; read < length; read += 4)
+    {
+        bool last = (read + 4 == length);
+        uint8_t padding = 0;
+        uint32_t group = 0;
+        for (uint8_t i = 0; i < 4; ++i)
+        {
+            char c = input[read + i];
+            int value;
+            if (c == '=' && last && i >= 2)
+            {
+                ++padding;
+                value = 0;
+            }
+            else
+            {
+                value = padding ? -1 : base64Value(c); // '=' 뒤에는 글자가 올 수 없음
+                if (value < 0)
+                    return -1;
+            }
+            group = (group << 6) | static_cast<uint32_t>(value);
+        }
+
+        uint8_t bytes = 3 - padding;
+        if (write + bytes > capacity)
+            return -1;
+        output[write++] = static_cast<uint8_t>(group >> 16);
+        if (bytes > 1)
+            output[write++] = static_cast<uint8_t>(group >> 8);
+        if (bytes > 2)
+            output[write++] = static_cast<uint8_t>(group);
+    }
+    return static_cast<int>(write);
+}
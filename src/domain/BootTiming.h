@@ -0,0 +1,16 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief 부팅 단계별 소요 시간 기록 (millis() 기준, 리셋 시점 0)
+ *
+ * setup()에서 각 단계가 끝날 때 기록하며 콘솔 'boot' 명령으로 조회한다.
+ */
+struct BootTiming
+{
+    uint32_t serialReadyMs;  // Serial.begin() 완료
+    uint32_t configLoadedMs; // 설정 레코드 로드 완료
+    uint32_t sensorsReadyMs; // 센서 목록 확보 (빠른 확인 또는 전체 검색)
+    uint32_t setupDoneMs;    // setup() 종료, 첫 변환 요청 직후
+    uint8_t fastBoot;        // 1: 지연 없는 빠른 부팅 모드로 빌드됨
+};
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// loop() 1회용 작업 영역 크기 (바이트, 가장 큰 주기 출력인 JSON 보고서 기준)
+#ifndef CYCLE_ARENA_SIZE
+#define CYCLE_ARENA_SIZE 3584
+#endif
+
+/**
+ * @brief 순차 할당 임시 메모리 영역 (loop() 1회 단위로 비움)
+ *
+ * 출력 프레임·JSON 문서처럼 한 번의 처리 동안만 쓰는 큰 작업 버퍼를 각자 정적 배열로
+ * 두지 않고 한 영역에서 앞에서부터 잘라 쓴다. 개별 해제는 없고 reset()으로 한꺼번에 비운다.
+ * 공간이 모자라면 nullptr를 반환하고 실패 횟수만 센다 (호출자는 해당 출력을 건너뜀).
+ *
+ * 받은 포인터는 다음 reset() 전까지만 유효하다. loop() 문맥에서만 사용한다.
+ * 한 함수 안에서만 쓰는 버퍼는 Scope로 감싸 함수가 끝날 때 그 지점까지 되돌린다
+ * (같은 loop()에서 이어지는 다른 출력이 같은 공간을 다시 씀).
+ */
+class BumpArena
+{
+public:
+    static constexpr size_t DEFAULT_ALIGNMENT = 8;
+
+    BumpArena(uint8_t *buffer, size_t capacity)
+        : buffer(buffer), capacity(capacity), used(0), highWater(0), failedCount(0)
+    {
+    }
+
+    void *allocate(size_t size, size_t alignment = DEFAULT_ALIGNMENT)
+    {
+        size_t start = (used + alignment - 1) & ~(alignment - 1);
+        if (start > capacity || size > capacity - start)
+        {
+            ++failedCount;
+            return nullptr;
+        }
+        used = start + size;
+        if (used > highWater)
+            highWater = used;
+        return buffer + start;
+    }
+
+    // 초기화하지 않은 배열 (정수·바이트 등 단순 형식용)
+    template <typename T>
+    T *allocateArray(size_t count)
+    {
+        return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void reset() { used = 0; }
+
+    // 생성 시점 이후의 할당을 소멸 시 반납
+    class Scope
+    {
+    public:
+        explicit Scope(BumpArena &arena) : arena(arena), mark(arena.used) {}
+        ~Scope() { arena.used = mark; }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        BumpArena &arena;
+        size_t mark;
+    };
+
+    size_t getCapacity() const { return capacity; }
+    size_t getUsed() const { return used; }
+    size_t getHighWater() const { return highWater; }
+    uint32_t getFailedCount() const { return failedCount; }
+
+private:
+    uint8_t *buffer;
+    size_t capacity;
+    size_t used;
+    size_t highWater;
+    uint32_t failedCount;
+};
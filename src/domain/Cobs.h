@@ -0,0 +1,76 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief COBS(Consistent Overhead Byte Stuffing) 인코딩/디코딩
+ *
+ * 인코딩 결과에는 0x00이 나타나지 않으므로 0x00을 프레임 구분자로 쓸 수 있다.
+ * 출력 길이는 최대 length + length / 254 + 1 바이트이다.
+ */
+constexpr size_t cobsMaxEncodedLength(size_t length)
+{
+    return length + length / 254 + 1;
+}
+
+// 반환값: 인코딩된 길이 (구분자 0x00 미포함)
+inline size_t cobsEncode(const uint8_t *input, size_t length, uint8_t *output)
+{
+    size_t read = 0;
+    size_t write = 1;
+    size_t codeIndex = 0;
+    uint8_t code = 1;
+
+    while (read < length)
+    {
+        if (input[read] == 0)
+        {
+            output[codeIndex] = code;
+            codeIndex = write++;
+            code = 1;
+        }
+        else
+        {
+            output[write++] = input[read];
+            if (++code == 0xFF)
+            {
+                output[codeIndex] = code;
+                codeIndex = write++;
+                code = 1;
+            }
+        }
+        ++read;
+    }
+    output[codeIndex] = code;
+    return write;
+}
+
+// 반환값: 디코딩된 길이, 형식 오류(0x00 포함, 길이 초과)면 0
+inline size_t cobsDecode(const uint8_t *input, size_t length, uint8_t *output, size_t capacity)
+{
+    size_t read = 0;
+    size_t write = 0;
+
+    while (read < length)
+    {
+        uint8_t code = input[read++];
+        if (code == 0)
+            return 0;
+
+        for (uint8_t i = 1; i < code; ++i)
+        {
+            if (read >= length || input[read] == 0 || write >= capacity)
+                return 0;
+            output[write++] = input[read++];
+        }
+
+        // 마지막 블록이 아니고 0xFF 블록도 아니면 원래 데이터의 0x00 복원
+        if (code != 0xFF && read < length)
+        {
+            if (write >= capacity)
+                return 0;
+            output[write++] = 0;
+        }
+    }
+    return write;
+}
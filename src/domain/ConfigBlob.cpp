@@ -0,0 +1,182 @@
+#include <cmath>
+#include <cstring>
+#include "ConfigBlob.h"
+#include "Crc16.h"
+#include "SensorConfigTable.h"
+
+namespace
+{
+constexpr int16_t MAX_CALIBRATION_CENTI = 500; // ±5°C (SensorController::setCalibrationOffset와 동일)
+
+void putU16(uint8_t *out, uint16_t value)
+{
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void putU32(uint8_t *out, uint32_t value)
+{
+    for (uint8_t i = 0; i < 4; ++i)
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+void putFloat(uint8_t *out, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    putU32(out, bits);
+}
+
+uint16_t getU16(const uint8_t *in)
+{
+    return static_cast<uint16_t>(in[0] | (in[1] << 8));
+}
+
+uint32_t getU32(const uint8_t *in)
+{
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < 4; ++i)
+        value |= static_cast<uint32_t>(in[i]) << (8 * i);
+    return value;
+}
+
+float getFloat(const uint8_t *in)
+{
+    uint32_t bits = getU32(in);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+bool isValidThreshold(float value)
+{
+    return !std::isnan(value) && value >= DS18B20_MIN_TEMP && value <= DS18B20_MAX_TEMP;
+}
+} // namespace
+
+namespace ConfigBlob
+{
+size_t encode(const SystemConfig &config, uint8_t *output)
+{
+    uint8_t *out = output + HEADER_SIZE;
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < CONFIG_MAX_SENSOR_RECORDS; ++i)
+    {
+        const SensorConfigRecord &record = config.sensorRecords[i];
+        if (record.rom == 0)
+            continue;
+
+        romToBytes(record.rom, out);
+        out[8] = record.logicalId;
+        out[9] = record.resolution;
+        out[10] = record.isCustomSet;
+        putFloat(out + 11, record.upperThreshold);
+        putFloat(out + 15, record.lowerThreshold);
+        putU16(out + 19, static_cast<uint16_t>(record.calibrationCenti));
+        out += RECORD_SIZE;
+        ++count;
+    }
+
+    output[0] = VERSION;
+    output[1] = count;
+    putU32(output + 2, config.measurementInterval);
+    output[6] = config.outputMode;
+    output[7] = config.deltaReporting;
+    putU16(output + 8, config.deltaDeadbandCenti);
+    output[10] = config.keyframeInterval;
+
+    size_t length = static_cast<size_t>(out - output);
+    putU16(out, crc16Ccitt(output, length));
+    return length + CRC_SIZE;
+}
+
+Result validate(const uint8_t *blob, size_t length)
+{
+    // 잘린 블롭(조각 누락)은 CRC보다 길이로 먼저 알림
+    uint8_t count = (length > 1) ? blob[1] : 0;
+    if (length < HEADER_SIZE + CRC_SIZE || count > CONFIG_MAX_SENSOR_RECORDS ||
+        length != HEADER_SIZE + count * RECORD_SIZE + CRC_SIZE)
+        return Result::Length;
+    if (crc16Ccitt(blob, length - CRC_SIZE) != getU16(blob + length - CRC_SIZE))
+        return Result::Crc;
+    if (blob[0] != VERSION)
+        return Result::Version;
+
+    uint32_t interval = getU32(blob + 2);
+    if (interval < MIN_MEASUREMENT_INTERVAL || interval > MAX_MEASUREMENT_INTERVAL ||
+        blob[6] > static_cast<uint8_t>(OutputMode::Dashboard) || blob[7] > 1 ||
+        getU16(blob + 8) > MAX_DELTA_DEADBAND_CENTI || blob[10] == 0)
+        return Result::Value;
+
+    const uint8_t *records = blob + HEADER_SIZE;
+    for (uint8_t i = 0; i < count; ++i)
+    {
+        const uint8_t *record = records + i * RECORD_SIZE;
+        uint64_t rom = romFromBytes(record);
+        float upper = getFloat(record + 11);
+        float lower = getFloat(record + 15);
+        int16_t calibration = static_cast<int16_t>(getU16(record + 19));
+        if (rom == 0 || record[8] > CONFIG_SENSOR_SLOTS || record[9] < 9 || record[9] > 12 || record[10] > 1 ||
+            !isValidThreshold(upper) || !isValidThreshold(lower) || upper <= lower ||
+            calibration < -MAX_CALIBRATION_CENTI || calibration > MAX_CALIBRATION_CENTI)
+            return Result::Value;
+
+        // 같은 ROM이나 같은 논리 ID(0 = 미할당 제외)가 두 번 나오면 어느 쪽을 쓸지 정할 수 없음
+        for (uint8_t j = 0; j < i; ++j)
+        {
+            const uint8_t *other = records + j * RECORD_SIZE;
+            if (romFromBytes(other) == rom || (record[8] != 0 && other[8] == record[8]))
+                return Result::Value;
+        }
+    }
+    return Result::Ok;
+}
+
+void applyTo(const uint8_t *blob, SystemConfig &config)
+{
+    config.measurementInterval = getU32(blob + 2);
+    config.outputMode = blob[6];
+    config.deltaReporting = blob[7];
+    config.deltaDeadbandCenti = getU16(blob + 8);
+    config.keyframeInterval = blob[10];
+
+    uint8_t count = blob[1];
+    const uint8_t *in = blob + HEADER_SIZE;
+    for (uint8_t i = 0; i < CONFIG_MAX_SENSOR_RECORDS; ++i)
+    {
+        SensorConfigRecord &record = config.sensorRecords[i];
+        if (i >= count)
+        {
+            record.setDefaults(0);
+            continue;
+        }
+
+        record.rom = romFromBytes(in);
+        record.logicalId = in[8];
+        record.resolution = in[9];
+        record.isCustomSet = in[10];
+        record.upperThreshold = getFloat(in + 11);
+        record.lowerThreshold = getFloat(in + 15);
+        record.calibrationCenti = static_cast<int16_t>(getU16(in + 19));
+        in += RECORD_SIZE;
+    }
+    config.legacyRowThresholdsPending = 0; // 가져온 레코드가 이전 표시 행 임계값보다 우선
+}
+
+const char *resultName(Result result)
+{
+    switch (result)
+    {
+    case Result::Ok:
+        return "ok";
+    case Result::Length:
+        return "length";
+    case Result::Crc:
+        return "crc";
+    case Result::Version:
+        return "version";
+    default:
+        return "value";
+    }
+}
+} // namespace ConfigBlob
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "SystemConfig.h"
+
+/**
+ * @brief 설정 내보내기/가져오기 블롭 (보드 간 설정 복제)
+ *
+ * 사용자가 정하는 설정만 담는다 (ROM별 ID·임계값·분해능·보정값, 측정 주기, 출력 형식, 변경분 출력).
+ * 보드마다 다른 값(마지막 버스 센서 목록, v1 표시 행 임계값)은 넣지 않는다.
+ *
+ *   [0]  VERSION
+ *   [1]  레코드 수 n (0~CONFIG_MAX_SENSOR_RECORDS)
+ *   [2]  측정 주기 ms (u32)
+ *   [6]  출력 형식, 변경분 출력 on/off (u8, u8)
+ *   [8]  데드밴드 0.01°C (u16), 키프레임 주기 (u8)
+ *   [11] 레코드 n개 × RECORD_SIZE: ROM(8, 표시 순서), ID, 분해능, 사용자 설정 여부,
+ *        상한/하한 (float), 보정값 0.01°C (i16)
+ *   끝   CRC-16/CCITT (앞의 모든 바이트, export 응답의 crc=는 이 두 바이트를 저장 순서대로 표시)
+ * 여러 바이트 값은 ROM을 빼고 모두 리틀 엔디언이다.
+ */
+namespace ConfigBlob
+{
+constexpr uint8_t VERSION = 1;
+constexpr size_t HEADER_SIZE = 11;
+constexpr size_t RECORD_SIZE = 21;
+constexpr size_t CRC_SIZE = 2;
+constexpr size_t MAX_SIZE = HEADER_SIZE + CONFIG_MAX_SENSOR_RECORDS * RECORD_SIZE + CRC_SIZE;
+
+enum class Result : uint8_t
+{
+    Ok,
+    Length,  // 길이가 레코드 수와 맞지 않음
+    Crc,     // CRC 불일치
+    Version, // 지원하지 않는 버전
+    Value    // 범위를 벗어난 값, 중복 ROM/ID
+};
+
+// 반환값: 블롭 길이 (output은 MAX_SIZE 이상)
+size_t encode(const SystemConfig &config, uint8_t *output);
+
+// 구조·CRC·값을 모두 검사 (설정은 바꾸지 않음)
+Result validate(const uint8_t *blob, size_t length);
+
+// validate()를 통과한 블롭을 적용: 담긴 필드를 덮어쓰고 ROM별 레코드는 블롭 내용으로 교체
+void applyTo(const uint8_t *blob, SystemConfig &config);
+
+const char *resultName(Result result); // 응답용 짧은 사유 ("length", "crc", ...)
+} // namespace ConfigBlob
@@ -0,0 +1,148 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Crc16.h"
+
+// 보존 로그 링 크기 (바이트, 2의 거듭제곱)
+#ifndef CRASH_LOG_SIZE
+#define CRASH_LOG_SIZE 1024
+#endif
+
+/**
+ * @brief 리셋 후에도 유지되는 텍스트 로그 링 (.noinit RAM 영역에 배치)
+ *
+ * 레코드 = 길이(1) + 세션 번호 하위 8비트(1) + 본문 CRC16(2) + 본문.
+ * 헤더(magic, session, head, tail)는 별도 CRC로 보호하며, 본문을 다 쓴 뒤에 head를
+ * 옮기므로 기록 도중 리셋되어도 이전까지의 레코드는 유효하다.
+ * 공간이 모자라면 가장 오래된 레코드부터 버린다 (기록 1회 비용은 본문 길이에 비례, 대기 없음).
+ * 전원 인가 시 RAM 내용은 임의 값이므로 헤더가 맞지 않으면 비운다.
+ */
+struct CrashLogRing
+{
+    static constexpr uint32_t MAGIC = 0x434C4731; // "CLG1"
+    static constexpr uint32_t CAPACITY = CRASH_LOG_SIZE;
+    static constexpr uint8_t RECORD_HEADER_SIZE = 4;
+    static constexpr uint8_t MAX_TEXT_LENGTH = 255;
+    static_assert(CAPACITY >= 64 && (CAPACITY & (CAPACITY - 1)) == 0, "CRASH_LOG_SIZE must be a power of two");
+
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t session; // 부팅마다 증가
+        uint32_t head;    // 누적 기록 바이트 (다음 기록 위치 = head % CAPACITY)
+        uint32_t tail;    // 가장 오래된 레코드 시작
+        uint16_t crc;
+    };
+
+    Header header;
+    uint8_t data[CAPACITY];
+
+    bool isValid() const
+    {
+        return header.magic == MAGIC && header.crc == computeHeaderCrc() && header.head - header.tail <= CAPACITY;
+    }
+
+    void clear()
+    {
+        header.magic = MAGIC;
+        header.session = 0;
+        header.head = 0;
+        header.tail = 0;
+        sealHeader();
+    }
+
+    // 부팅 시 1회 호출: 유효하면 이전 레코드를 유지한 채 새 세션 시작, 아니면 비움
+    void beginSession()
+    {
+        if (!isValid())
+            clear();
+        ++header.session;
+        sealHeader();
+    }
+
+    void discardAll()
+    {
+        header.tail = header.head;
+        sealHeader();
+    }
+
+    void append(const char *text, size_t length)
+    {
+        if (length > MAX_TEXT_LENGTH)
+            length = MAX_TEXT_LENGTH;
+        uint32_t needed = RECORD_HEADER_SIZE + length;
+
+        // 오래된 레코드를 버려 공간 확보 (버리는 레코드는 최소 4바이트이므로 반복 횟수는 length에 비례)
+        if (CAPACITY - (header.head - header.tail) < needed)
+        {
+            while (CAPACITY - (header.head - header.tail) < needed)
+            {
+                uint32_t recordSize = RECORD_HEADER_SIZE + at(header.tail);
+                header.tail = (header.head - header.tail > recordSize) ? header.tail + recordSize : header.head;
+            }
+            sealHeader();
+        }
+
+        uint16_t crc = crc16Ccitt(text, length);
+        uint32_t pos = header.head;
+        at(pos++) = static_cast<uint8_t>(length);
+        at(pos++) = static_cast<uint8_t>(header.session);
+        at(pos++) = static_cast<uint8_t>(crc & 0xFF);
+        at(pos++) = static_cast<uint8_t>(crc >> 8);
+        for (size_t i = 0; i < length; ++i)
+        {
+            at(pos++) = static_cast<uint8_t>(text[i]);
+        }
+
+        header.head = pos;
+        sealHeader();
+    }
+
+    /**
+     * @brief 오래된 순서로 레코드를 읽어 fn(이전 세션 여부, 본문, 길이) 호출
+     * @return 모두 정상이면 true, 손상된 레코드를 만나면 그 지점에서 멈추고 false
+     */
+    template <typename Fn>
+    bool forEachRecord(Fn fn) const
+    {
+        char text[MAX_TEXT_LENGTH];
+        uint32_t pos = header.tail;
+
+        while (pos != header.head)
+        {
+            if (header.head - pos < RECORD_HEADER_SIZE)
+                return false;
+
+            uint8_t length = at(pos);
+            uint8_t session = at(pos + 1);
+            uint16_t crc = static_cast<uint16_t>(at(pos + 2) | (at(pos + 3) << 8));
+            if (header.head - pos < static_cast<uint32_t>(RECORD_HEADER_SIZE + length))
+                return false;
+
+            for (uint8_t i = 0; i < length; ++i)
+            {
+                text[i] = static_cast<char>(at(pos + RECORD_HEADER_SIZE + i));
+            }
+            if (crc != crc16Ccitt(text, length))
+                return false;
+
+            fn(session != static_cast<uint8_t>(header.session), text, length);
+            pos += RECORD_HEADER_SIZE + length;
+        }
+        return true;
+    }
+
+private:
+    uint8_t &at(uint32_t pos) { return data[pos & (CAPACITY - 1)]; }
+    uint8_t at(uint32_t pos) const { return data[pos & (CAPACITY - 1)]; }
+
+    uint16_t computeHeaderCrc() const
+    {
+        return crc16Ccitt(&header, offsetof(Header, crc));
+    }
+
+    void sealHeader()
+    {
+        header.crc = computeHeaderCrc();
+    }
+};
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief CRC-16/CCITT-FALSE 계산 (다항식 0x1021, 초기값 0xFFFF)
+ *
+ * 테이블 없이 비트 단위로 계산하여 플래시 사용량을 최소화한다.
+ * seed에 이전 결과를 넘기면 여러 블록을 이어서 계산할 수 있다.
+ */
+inline uint16_t crc16Ccitt(const void *data, size_t length, uint16_t seed = 0xFFFF)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    uint16_t crc = seed;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        crc ^= static_cast<uint16_t>(bytes[i]) << 8;
+        for (uint8_t bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+        }
+    }
+    return crc;
+}
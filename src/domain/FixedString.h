@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+/**
+ * @brief 고정 용량 인라인 문자열 (힙 할당 없음)
+ *
+ * 시리얼 입력처럼 한 글자씩 쌓는 짧은 문자열용. String의 += 와 달리 재할당이 없어
+ * 장기 가동 중 힙 단편화가 생기지 않는다. 용량을 넘는 append()는 false를 반환하고
+ * 내용은 그대로 둔다 (넘침 처리는 호출자가 결정).
+ */
+template <size_t Capacity>
+class FixedString
+{
+public:
+    static constexpr size_t CAPACITY = Capacity;
+
+    FixedString() { clear(); }
+
+    void clear()
+    {
+        len = 0;
+        text[0] = '\0';
+    }
+
+    bool append(char c)
+    {
+        if (len >= Capacity)
+            return false;
+        text[len++] = c;
+        text[len] = '\0';
+        return true;
+    }
+
+    size_t length() const { return len; }
+    bool isEmpty() const { return len == 0; }
+    bool isFull() const { return len >= Capacity; }
+    const char *c_str() const { return text; }
+    std::string_view view() const { return std::string_view(text, len); }
+    const char *begin() const { return text; }
+    const char *end() const { return text + len; }
+
+    bool startsWith(const char *prefix) const
+    {
+        size_t prefixLength = strlen(prefix);
+        return prefixLength <= len && memcmp(text, prefix, prefixLength) == 0;
+    }
+
+    bool operator==(const char *other) const { return view() == std::string_view(other); }
+    bool operator!=(const char *other) const { return !(*this == other); }
+
+private:
+    char text[Capacity + 1];
+    size_t len;
+};
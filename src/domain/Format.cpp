@@ -0,0 +1,194 @@
+#include "Format.h"
+#include "UiText.h"
+
+namespace
+{
+// 1/16°C 소수부를 0.0001°C 단위로 (n × 625)
+const uint16_t SIXTEENTH_FRACTION_E4[16] = {
+    0, 625, 1250, 1875, 2500, 3125, 3750, 4375,
+    5000, 5625, 6250, 6875, 7500, 8125, 8750, 9375};
+
+const uint16_t POW10[5] = {1, 10, 100, 1000, 10000};
+
+// 간단한 출력 커서: 용량을 넘으면 더 쓰지 않음
+struct Writer
+{
+    char *out;
+    size_t capacity;
+    size_t length;
+
+    Writer(char *buffer, size_t size) : out(buffer), capacity(size), length(0)
+    {
+        if (capacity > 0)
+            out[0] = '\0';
+    }
+
+    void put(char c)
+    {
+        if (length + 1 >= capacity)
+            return;
+        out[length++] = c;
+        out[length] = '\0';
+    }
+
+    void put(const char *text)
+    {
+        while (*text)
+        {
+            put(*text++);
+        }
+    }
+
+    void putUnsigned(uint32_t value)
+    {
+        char digits[10];
+        uint8_t count = 0;
+        do
+        {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        while (count > 0)
+        {
+            put(digits[--count]);
+        }
+    }
+
+    // 앞자리 0을 채운 소수부
+    void putFraction(uint32_t fraction, uint8_t decimals)
+    {
+        for (uint8_t place = decimals; place > 0; --place)
+        {
+            put(static_cast<char>('0' + (fraction / POW10[place - 1]) % 10));
+        }
+    }
+};
+} // namespace
+
+namespace Format
+{
+size_t temperature(char *out, size_t capacity, int32_t sixteenths, uint8_t decimals)
+{
+    if (decimals < 1)
+        decimals = 1;
+    if (decimals > 4)
+        decimals = 4;
+
+    Writer w(out, capacity);
+    uint32_t magnitude = (sixteenths < 0) ? 0u - static_cast<uint32_t>(sixteenths) : static_cast<uint32_t>(sixteenths);
+    uint32_t whole = magnitude >> 4;
+
+    // 소수부는 표에서 0.0001°C 단위로 읽고 필요한 자릿수로 반올림 (올림 시 정수부로 자리올림)
+    uint16_t divisor = POW10[4 - decimals];
+    uint32_t fraction = (SIXTEENTH_FRACTION_E4[magnitude & 0x0F] + divisor / 2) / divisor;
+    if (fraction >= POW10[decimals])
+    {
+        fraction -= POW10[decimals];
+        ++whole;
+    }
+
+    if (sixteenths < 0)
+        w.put('-');
+    w.putUnsigned(whole);
+    w.put('.');
+    w.putFraction(fraction, decimals);
+    return w.length;
+}
+
+size_t fixed(char *out, size_t capacity, int32_t scaled, uint8_t decimals)
+{
+    if (decimals > 4)
+        decimals = 4;
+
+    // -0.5 같은 값도 부호를 유지하도록 정수부와 소수부를 분리해서 출력
+    Writer w(out, capacity);
+    uint32_t magnitude = (scaled < 0) ? 0u - static_cast<uint32_t>(scaled) : static_cast<uint32_t>(scaled);
+    if (scaled < 0)
+        w.put('-');
+    w.putUnsigned(magnitude / POW10[decimals]);
+    if (decimals > 0)
+    {
+        w.put('.');
+        w.putFraction(magnitude % POW10[decimals], decimals);
+    }
+    return w.length;
+}
+
+size_t trimFraction(char *text, size_t length)
+{
+    bool hasPoint = false;
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (text[i] == '.')
+            hasPoint = true;
+    }
+    if (!hasPoint)
+        return length;
+
+    while (length > 0 && text[length - 1] == '0')
+    {
+        --length;
+    }
+    if (length > 0 && text[length - 1] == '.')
+        --length;
+    text[length] = '\0';
+    return length;
+}
+
+size_t integer(char *out, size_t capacity, int32_t value)
+{
+    Writer w(out, capacity);
+    if (value < 0)
+        w.put('-');
+    w.putUnsigned((value < 0) ? 0u - static_cast<uint32_t>(value) : static_cast<uint32_t>(value));
+    return w.length;
+}
+
+size_t unsignedInteger(char *out, size_t capacity, uint32_t value)
+{
+    Writer w(out, capacity);
+    w.putUnsigned(value);
+    return w.length;
+}
+
+size_t romHex(char *out, size_t capacity, const uint8_t *addr)
+{
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+    Writer w(out, capacity);
+    for (uint8_t i = 0; i < 8; ++i)
+    {
+        w.put(HEX_DIGITS[addr[i] >> 4]);
+        w.put(HEX_DIGITS[addr[i] & 0x0F]);
+    }
+    return w.length;
+}
+
+size_t interval(char *out, size_t capacity, unsigned long intervalMs)
+{
+    static const char *const UNIT_NAMES[4] = {ui(UiText::UNIT_DAY), ui(UiText::UNIT_HOUR),
+                                              ui(UiText::UNIT_MINUTE), ui(UiText::UNIT_SECOND)};
+    static const uint32_t UNIT_SECONDS[4] = {86400, 3600, 60, 1};
+
+    Writer w(out, capacity);
+    uint32_t remaining = intervalMs / 1000;
+    if (remaining < 60)
+    {
+        w.putUnsigned(remaining);
+        w.put(UNIT_NAMES[3]);
+        return w.length;
+    }
+
+    for (uint8_t i = 0; i < 4; ++i)
+    {
+        uint32_t amount = remaining / UNIT_SECONDS[i];
+        remaining %= UNIT_SECONDS[i];
+        if (amount == 0)
+            continue;
+        if (w.length > 0)
+            w.put(' ');
+        w.putUnsigned(amount);
+        w.put(UNIT_NAMES[i]);
+    }
+    return w.length;
+}
+} // namespace Format
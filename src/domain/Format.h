@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief 할당 없는 문자열 포맷 함수 모음
+ *
+ * 모든 함수는 호출자가 준 버퍼에 '\0'으로 끝나는 문자열을 쓰고 길이를 반환한다.
+ * 버퍼가 작으면 들어가는 만큼만 쓴다 (항상 '\0' 종료). float/String/printf를 쓰지 않는다.
+ */
+namespace Format
+{
+constexpr size_t TEMPERATURE_SIZE = 12; // "-55.0625" + 여유
+constexpr size_t ROM_HEX_SIZE = 17;     // 16자리 + '\0'
+constexpr size_t INTERVAL_SIZE = 40;    // "30일 23시간 59분 59초" (UTF-8)
+
+// 온도: 1/16°C 단위 정수 (DS18B20 12비트 분해능), 소수 1~4자리 (반올림, 0에서 먼 쪽)
+size_t temperature(char *out, size_t capacity, int32_t sixteenths, uint8_t decimals);
+
+// 고정소수점: (scaled, decimals) = (-325, 2) → "-3.25"
+size_t fixed(char *out, size_t capacity, int32_t scaled, uint8_t decimals);
+
+// 소수부 끝의 0과 남은 소수점 제거: "23.5000" → "23.5", "-4.0000" → "-4" (새 길이 반환)
+size_t trimFraction(char *text, size_t length);
+
+// 부호 있는 10진 정수
+size_t integer(char *out, size_t capacity, int32_t value);
+
+// 부호 없는 10진 정수 (millis() 시각, 측정 주기 ms 등 2^31 이상이 될 수 있는 값)
+size_t unsignedInteger(char *out, size_t capacity, uint32_t value);
+
+// ROM 주소 8바이트 → 16자리 대문자 16진수 (표시 순서, addr[0]이 family code)
+size_t romHex(char *out, size_t capacity, const uint8_t *addr);
+
+// 측정 주기 → "1일 2시간 3분 4초" (0인 단위는 생략, 1분 미만은 "N초", 단위 이름은 UiText)
+size_t interval(char *out, size_t capacity, unsigned long intervalMs);
+
+// float 온도 → 1/16°C 단위 (반올림)
+inline int32_t toSixteenths(float celsius)
+{
+    return static_cast<int32_t>(celsius >= 0 ? celsius * 16 + 0.5f : celsius * 16 - 0.5f);
+}
+} // namespace Format
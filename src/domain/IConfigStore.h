@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include "SystemConfig.h"
+
+/**
+ * @brief 설정 저장소 인터페이스
+ *
+ * 시스템 설정을 RAM 섀도우로 유지하고 영구 저장소와 동기화하는 추상 인터페이스.
+ * config()는 항상 최신 섀도우를 반환하므로 기록이 끝나기 전에도 변경값을 읽을 수 있다.
+ */
+class IConfigStore
+{
+public:
+    enum LoadResult
+    {
+        LOADED = 0,          // 유효한 레코드 로드
+        UPGRADED = 1,        // 이전 버전 레코드를 현재 버전으로 변환
+        MIGRATED_LEGACY = 2, // 고정 주소 레거시 레이아웃에서 이전
+        DEFAULTS = 3         // 유효한 데이터 없음, 기본값 사용
+    };
+
+    virtual ~IConfigStore() = default;
+
+    virtual LoadResult load() = 0;
+    virtual bool save() = 0; // 트랜잭션 중에는 변경 표시만 하고 commit() 시 기록 예약
+
+    // 여러 변경을 RAM에서 모은 뒤 한 번의 기록으로 커밋 (중첩 가능)
+    // 반환값: 이번 commit으로 기록이 예약되었는지 여부
+    virtual void beginTransaction() = 0;
+    virtual bool commit() = 0;
+    virtual bool inTransaction() const = 0;
+
+    // 예약된 기록을 백그라운드에서 조금씩 처리 (loop()에서 호출)
+    virtual void update() = 0;
+    virtual bool flush() = 0; // 예약된 기록을 즉시 완료
+    virtual bool isWritePending() const = 0;
+
+    virtual SystemConfig &config() = 0;
+    virtual const SystemConfig &config() const = 0;
+    virtual uint32_t getSequence() const = 0;
+};
@@ -1,9 +1,25 @@
 #pragma once
+#include <type_traits>
+#include "LineBuffer.h"
+
+// 컴파일 시 로그 하한 (0: DEBUG, 1: INFO, 2: WARNING, 3: ERROR, 4: 모두 제거)
+// 하한보다 낮은 LOG_* 호출은 인자 평가와 문자열까지 빌드에서 빠진다.
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_WARNING 2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_NONE 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
 
 /**
  * @brief 로거 인터페이스
  *
- * 시스템 로깅을 위한 추상 인터페이스
+ * 시스템 로깅을 위한 추상 인터페이스.
+ * 진단 출력은 LOG_DEBUG/LOG_INFO/LOG_WARNING/LOG_ERROR 매크로로 남기고,
+ * 매크로는 컴파일 시 하한(LOG_LEVEL) 미만이면 빈 문장이 된다.
  */
 class ILogger
 {
@@ -24,4 +40,72 @@ public:
     virtual void warning(const char *message) = 0;
     virtual void error(const char *message) = 0;
     virtual void setLogLevel(LogLevel level) = 0;
+    virtual bool isEnabled(LogLevel level) const = 0;
+
+    // 바이너리 추적 로그 (LOG_TRACE). 텍스트 로거는 형식 표가 없으므로 기본 구현은 무시한다.
+    virtual void trace(uint16_t /*id*/, const int32_t * /*args*/, uint8_t /*count*/) {}
+
+    /**
+     * @brief 문자열/정수 인자를 한 줄로 이어 붙여 기록 (힙 할당 없음)
+     *
+     * 런타임 레벨에서 걸러지면 조립하지 않는다. 직접 호출하지 말고 LOG_* 매크로를 사용.
+     */
+    template <typename... Args>
+    void write(LogLevel level, const Args &...args)
+    {
+        if (!isEnabled(level))
+            return;
+
+        LineBuffer line;
+        (appendArg(line, args), ...);
+        log(level, line.c_str());
+    }
+
+private:
+    static void appendArg(LineBuffer &line, const char *text) { line.append(text); }
+    static void appendArg(LineBuffer &line, char c) { line.append(c); }
+
+    template <typename T>
+    static void appendArg(LineBuffer &line, T value)
+    {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "log argument must be text or integer");
+        // millis() 시각 같은 부호 없는 값은 2^31 이상에서도 음수로 보이지 않게 그대로 출력
+        if constexpr (std::is_unsigned<T>::value)
+            line.appendUInt(static_cast<uint32_t>(value));
+        else
+            line.appendInt(static_cast<int32_t>(value));
+    }
 };
+
+// logger: ILogger 포인터 (nullptr이면 무시)
+#define LOG_AT(logger, level, ...)                 \
+    do                                             \
+    {                                              \
+        ILogger *logTarget_ = (logger);            \
+        if (logTarget_)                            \
+            logTarget_->write(level, __VA_ARGS__); \
+    } while (0)
+
+#if LOG_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(logger, ...) LOG_AT(logger, ILogger::DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(logger, ...) do { } while (0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(logger, ...) LOG_AT(logger, ILogger::INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(logger, ...) do { } while (0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_WARNING
+#define LOG_WARNING(logger, ...) LOG_AT(logger, ILogger::WARNING, __VA_ARGS__)
+#else
+#define LOG_WARNING(logger, ...) do { } while (0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(logger, ...) LOG_AT(logger, ILogger::ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(logger, ...) do { } while (0)
+#endif
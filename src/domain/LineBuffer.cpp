@@ -0,0 +1,91 @@
+#include "LineBuffer.h"
+#include "Format.h"
+
+void LineBuffer::clear()
+{
+    len = 0;
+    truncated = false;
+    text[0] = '\0';
+}
+
+LineBuffer &LineBuffer::append(const char *str)
+{
+    while (*str)
+    {
+        append(*str++);
+    }
+    return *this;
+}
+
+LineBuffer &LineBuffer::append(char c)
+{
+    if (len >= CAPACITY)
+    {
+        truncated = true;
+        return *this;
+    }
+    text[len++] = c;
+    text[len] = '\0';
+    return *this;
+}
+
+LineBuffer &LineBuffer::appendInt(int32_t value)
+{
+    char digits[12];
+    Format::integer(digits, sizeof(digits), value);
+    return append(digits);
+}
+
+LineBuffer &LineBuffer::appendUInt(uint32_t value)
+{
+    char digits[11];
+    Format::unsignedInteger(digits, sizeof(digits), value);
+    return append(digits);
+}
+
+LineBuffer &LineBuffer::appendFixed(int32_t scaled, uint8_t decimals)
+{
+    char digits[16];
+    Format::fixed(digits, sizeof(digits), scaled, decimals);
+    return append(digits);
+}
+
+LineBuffer &LineBuffer::appendTemperature(int32_t sixteenths, uint8_t decimals)
+{
+    char digits[Format::TEMPERATURE_SIZE];
+    Format::temperature(digits, sizeof(digits), sixteenths, decimals);
+    return append(digits);
+}
+
+LineBuffer &LineBuffer::appendRomHex(const uint8_t *addr)
+{
+    char hex[Format::ROM_HEX_SIZE];
+    Format::romHex(hex, sizeof(hex), addr);
+    return append(hex);
+}
+
+LineBuffer &LineBuffer::appendInterval(unsigned long intervalMs)
+{
+    char text[Format::INTERVAL_SIZE];
+    Format::interval(text, sizeof(text), intervalMs);
+    return append(text);
+}
+
+LineBuffer &LineBuffer::appendHexByte(uint8_t value)
+{
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+    append(HEX_DIGITS[value >> 4]);
+    return append(HEX_DIGITS[value & 0x0F]);
+}
+
+LineBuffer &LineBuffer::appendLineEnd()
+{
+    // 줄바꿈용 2바이트는 용량과 별도로 예약되어 있음
+    if (len <= CAPACITY)
+    {
+        text[len++] = '\r';
+        text[len++] = '\n';
+        text[len] = '\0';
+    }
+    return *this;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief 고정 크기 한 줄 출력 버퍼
+ *
+ * 힙 할당 없이 한 줄을 조립한 뒤 write() 한 번으로 내보내기 위한 용도.
+ * 용량을 넘는 내용은 잘라내고 truncated 플래그만 남긴다.
+ */
+class LineBuffer
+{
+public:
+    static constexpr size_t CAPACITY = 192;
+
+    LineBuffer() { clear(); }
+
+    void clear();
+    LineBuffer &append(const char *text);
+    LineBuffer &append(char c);
+    LineBuffer &appendInt(int32_t value);
+    LineBuffer &appendUInt(uint32_t value); // millis() 시각, ms 단위 주기 (24.8일 이후에도 음수 없음)
+    LineBuffer &appendTenths(int32_t tenths) { return appendFixed(tenths, 1); } // 253 → "25.3"
+    LineBuffer &appendFixed(int32_t scaled, uint8_t decimals);                 // (-325, 2) → "-3.25"
+    LineBuffer &appendHexByte(uint8_t value); // 항상 2자리 대문자
+    LineBuffer &appendTemperature(int32_t sixteenths, uint8_t decimals); // 1/16°C 단위, 소수 1~4자리
+    LineBuffer &appendRomHex(const uint8_t *addr);                       // 16자리 대문자
+    LineBuffer &appendInterval(unsigned long intervalMs);                // "1일 2시간 3분 4초"
+    LineBuffer &appendLineEnd();              // "\r\n" (Print::println과 동일, 잘려도 항상 기록)
+
+    const char *c_str() const { return text; }
+    const uint8_t *data() const { return reinterpret_cast<const uint8_t *>(text); }
+    size_t length() const { return len; }
+    bool isTruncated() const { return truncated; }
+
+private:
+    char text[CAPACITY + 3]; // 내용 + 줄바꿈 2바이트 + '\0'
+    size_t len;
+    bool truncated;
+};
+
+// 고정소수점 변환 (반올림, 0에서 먼 쪽)
+inline int32_t toScaled(float value, int32_t scale)
+{
+    return static_cast<int32_t>(value >= 0 ? value * scale + 0.5f : value * scale - 0.5f);
+}
+
+inline int32_t toTenths(float value)
+{
+    return toScaled(value, 10);
+}
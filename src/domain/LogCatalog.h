@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "ILogger.h"
+#include "TelemetryProtocol.h"
+
+// 0으로 빌드하면 LOG_TRACE 호출이 모두 빠짐 (기본: 운영 빌드에서도 기록)
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1
+#endif
+
+/**
+ * @brief 바이너리 추적 로그 메시지 목록 (펌웨어와 호스트 디코더 공용)
+ *
+ * 펌웨어는 메시지 ID, 시각, 정수 인자만 RAM 링에 기록하고, 문장 조립은
+ * 호스트 디코더(tools/telemetry/decode_trace.cpp)가 이 목록의 형식 문자열로 한다.
+ * 형식 문자열은 펌웨어에서 상수식(인자 개수 검사)으로만 쓰이므로 플래시에 들어가지 않는다.
+ *
+ * 지정자: %d 부호 있는 정수, %u 부호 없는 정수, %X 16진수, %t 1/100°C (소수 2자리로 표시)
+ * ID는 목록 순서이므로 항목은 끝에만 추가한다 (이전 캡처 해석 유지).
+ */
+#define LOG_CATALOG(X) \
+    X(MENU_STATE, "메뉴 상태 %d -> %d") \
+    X(SENSOR_ID_SET, "센서 idx %d 논리 ID %d -> %d") \
+    X(SENSOR_ID_UNCHANGED, "센서 idx %d 논리 ID 변경 없음 (%d)") \
+    X(ROSTER_CHANGED, "센서 구성 변경 %d -> %d개") \
+    X(CONVERSION_DONE, "측정 완료: 센서 %d개, 추가 대기 %ums") \
+    X(ALARM_CHANGED, "경보 ID %d 상태 0x%X -> 0x%X (%t°C)") \
+    X(THRESHOLD_SET, "임계값 ROM ..%X 상한 %t°C 하한 %t°C")
+
+enum class LogId : uint16_t
+{
+#define LOG_CATALOG_ID(id, format) id,
+    LOG_CATALOG(LOG_CATALOG_ID)
+#undef LOG_CATALOG_ID
+    COUNT
+};
+
+namespace LogCatalog
+{
+#define LOG_CATALOG_FORMAT(id, format) format,
+constexpr const char *const FORMAT[] = {LOG_CATALOG(LOG_CATALOG_FORMAT)};
+#undef LOG_CATALOG_FORMAT
+
+static_assert(sizeof(FORMAT) / sizeof(FORMAT[0]) == static_cast<size_t>(LogId::COUNT), "log catalog size mismatch");
+
+// 형식 문자열의 지정자 개수 ("%%"는 제외)
+constexpr uint8_t argCount(const char *format)
+{
+    uint8_t count = 0;
+    for (; *format; ++format)
+    {
+        if (*format != '%')
+            continue;
+        if (format[1] == '%')
+            ++format;
+        else
+            ++count;
+    }
+    return count;
+}
+
+constexpr uint8_t argCount(LogId id)
+{
+    return argCount(FORMAT[static_cast<size_t>(id)]);
+}
+} // namespace LogCatalog
+
+/**
+ * @brief 추적 로그 기록 (LOG_TRACE 매크로로 호출)
+ *
+ * 인자 개수를 컴파일 시 형식 문자열과 대조하고, 정수로 변환한 인자 배열만 넘긴다.
+ */
+template <LogId Id, typename... Args>
+inline void logTrace(ILogger *logger, Args... args)
+{
+    static_assert(sizeof...(Args) == LogCatalog::argCount(Id), "trace arguments do not match catalog format");
+    static_assert(sizeof...(Args) <= Telemetry::LOG_MAX_ARGS, "too many trace arguments");
+
+    if (!logger)
+        return;
+    const int32_t values[sizeof...(Args) + 1] = {static_cast<int32_t>(args)...};
+    logger->trace(static_cast<uint16_t>(Id), values, sizeof...(Args));
+}
+
+#if TRACE_ENABLED
+#define LOG_TRACE(logger, id, ...) logTrace<LogId::id>(logger, ##__VA_ARGS__)
+#else
+#define LOG_TRACE(logger, id, ...) do { } while (0)
+#endif
@@ -0,0 +1,98 @@
+#include "SensorConfigTable.h"
+
+static_assert(CONFIG_MAX_SENSOR_RECORDS < SensorConfigTable::BUCKET_COUNT, "hash table needs free buckets");
+
+SensorConfigTable::SensorConfigTable(SensorConfigRecord *recordArray, uint8_t maxRecords)
+    : records(recordArray), recordCapacity(maxRecords), count(0)
+{
+    for (uint8_t b = 0; b < BUCKET_COUNT; ++b)
+    {
+        buckets[b] = EMPTY_BUCKET;
+    }
+}
+
+void SensorConfigTable::rebuild()
+{
+    for (uint8_t b = 0; b < BUCKET_COUNT; ++b)
+    {
+        buckets[b] = EMPTY_BUCKET;
+    }
+    count = 0;
+
+    for (uint8_t i = 0; i < recordCapacity; ++i)
+    {
+        // 빈 레코드와 중복 ROM(손상된 데이터)은 건너뜀
+        if (records[i].rom == 0 || find(records[i].rom) != nullptr)
+            continue;
+        link(i);
+    }
+}
+
+SensorConfigRecord *SensorConfigTable::find(uint64_t rom) const
+{
+    if (rom == 0)
+        return nullptr;
+
+    uint8_t b = hash(rom);
+    for (uint8_t probe = 0; probe < BUCKET_COUNT; ++probe)
+    {
+        int8_t index = buckets[b];
+        if (index == EMPTY_BUCKET)
+            return nullptr;
+        if (records[index].rom == rom)
+            return &records[index];
+        b = (b + 1) & (BUCKET_COUNT - 1);
+    }
+    return nullptr;
+}
+
+SensorConfigRecord *SensorConfigTable::insert(uint64_t rom)
+{
+    if (rom == 0)
+        return nullptr;
+
+    SensorConfigRecord *existing = find(rom);
+    if (existing)
+        return existing;
+
+    for (uint8_t i = 0; i < recordCapacity; ++i)
+    {
+        if (records[i].rom != 0)
+            continue;
+
+        records[i].setDefaults(rom);
+        link(i);
+        return &records[i];
+    }
+    return nullptr;
+}
+
+bool SensorConfigTable::remove(uint64_t rom)
+{
+    SensorConfigRecord *record = find(rom);
+    if (!record)
+        return false;
+
+    // 선형 탐사 체인을 유지하기 위해 인덱스 전체 재구성 (최대 16개)
+    record->setDefaults(0);
+    rebuild();
+    return true;
+}
+
+uint8_t SensorConfigTable::hash(uint64_t rom)
+{
+    // 피보나치 해싱: 상위 5비트(32 버킷)를 버킷 인덱스로 사용
+    static_assert(BUCKET_COUNT == 32, "hash shift assumes 32 buckets");
+    return static_cast<uint8_t>((rom * 0x9E3779B97F4A7C15ULL) >> 59);
+}
+
+void SensorConfigTable::link(uint8_t recordIndex)
+{
+    uint8_t b = hash(records[recordIndex].rom);
+    while (buckets[b] != EMPTY_BUCKET)
+    {
+        b = (b + 1) & (BUCKET_COUNT - 1);
+    }
+    buckets[b] = static_cast<int8_t>(recordIndex);
+    ++count;
+}
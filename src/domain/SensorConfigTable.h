@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include "SystemConfig.h"
+
+// DeviceAddress(8바이트) <-> 64비트 ROM 변환 (첫 바이트가 최상위, 표시 순서와 동일)
+inline uint64_t romFromBytes(const uint8_t *bytes)
+{
+    uint64_t rom = 0;
+    for (uint8_t i = 0; i < 8; ++i)
+    {
+        rom = (rom << 8) | bytes[i];
+    }
+    return rom;
+}
+
+inline void romToBytes(uint64_t rom, uint8_t *bytes)
+{
+    for (int i = 7; i >= 0; --i)
+    {
+        bytes[i] = static_cast<uint8_t>(rom & 0xFF);
+        rom >>= 8;
+    }
+}
+
+/**
+ * @brief ROM 주소로 센서 설정 레코드를 찾는 개방 주소법 해시 테이블
+ *
+ * 레코드 자체는 설정 레코드(SystemConfig::sensorRecords)에 그대로 두고,
+ * RAM에는 버킷 → 레코드 인덱스만 유지한다. 측정 경로의 조회는 O(1)이다.
+ */
+class SensorConfigTable
+{
+public:
+    static constexpr uint8_t BUCKET_COUNT = 32; // 2의 거듭제곱, 레코드 수의 2배
+
+    SensorConfigTable(SensorConfigRecord *recordArray, uint8_t maxRecords);
+
+    void rebuild(); // 레코드 배열이 외부에서 바뀐 뒤(로드 등) 인덱스 재구성
+    SensorConfigRecord *find(uint64_t rom) const;
+    SensorConfigRecord *insert(uint64_t rom); // 가득 차면 nullptr
+    bool remove(uint64_t rom);
+
+    uint8_t size() const { return count; }
+    uint8_t capacity() const { return recordCapacity; }
+    SensorConfigRecord *recordAt(uint8_t index) const { return &records[index]; }
+    uint8_t indexOf(const SensorConfigRecord *record) const { return static_cast<uint8_t>(record - records); }
+
+private:
+    static constexpr int8_t EMPTY_BUCKET = -1;
+
+    SensorConfigRecord *records;
+    uint8_t recordCapacity;
+    uint8_t count;
+    int8_t buckets[BUCKET_COUNT];
+
+    static uint8_t hash(uint64_t rom);
+    void link(uint8_t recordIndex);
+};
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+
+/**
+ * @brief 고정 용량 인라인 배열 컨테이너 (힙 할당 없음)
+ *
+ * std::vector 대신 최대 개수가 정해진 목록(센서 번호 등)에 쓴다. 원소는 객체 안에 바로
+ * 저장되며, 용량을 넘는 push_back()은 false를 반환하고 목록은 그대로 둔다.
+ * T는 기본 생성·복사가 가능한 작은 값 형식으로 한정한다 (원소 소멸자 호출 없음).
+ */
+template <typename T, size_t Capacity>
+class StaticVector
+{
+public:
+    static constexpr size_t CAPACITY = Capacity;
+
+    StaticVector() : count(0) {}
+
+    bool push_back(const T &value)
+    {
+        if (count >= Capacity)
+            return false;
+        items[count++] = value;
+        return true;
+    }
+
+    void clear() { count = 0; }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    bool full() const { return count >= Capacity; }
+    static constexpr size_t capacity() { return Capacity; }
+
+    T &operator[](size_t i) { return items[i]; }
+    const T &operator[](size_t i) const { return items[i]; }
+    T *data() { return items; }
+    const T *data() const { return items; }
+
+    T *begin() { return items; }
+    T *end() { return items + count; }
+    const T *begin() const { return items; }
+    const T *end() const { return items + count; }
+
+private:
+    T items[Capacity];
+    size_t count;
+};
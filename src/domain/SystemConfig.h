@@ -0,0 +1,126 @@
+#pragma once
+#include <cstdint>
+
+// DS18B20 온도 범위 상수
+constexpr float DS18B20_MIN_TEMP = -55.0f;
+constexpr float DS18B20_MAX_TEMP = 125.0f;
+
+// 임계값 기본값
+constexpr float DEFAULT_UPPER_THRESHOLD = 30.0f;
+constexpr float DEFAULT_LOWER_THRESHOLD = 20.0f;
+
+// 측정 주기 관련 상수
+constexpr unsigned long MIN_MEASUREMENT_INTERVAL = 10000;      // 10초 (밀리초)
+constexpr unsigned long MAX_MEASUREMENT_INTERVAL = 2592000000; // 30일 (밀리초)
+constexpr unsigned long DEFAULT_MEASUREMENT_INTERVAL = 15000;  // 15초 (밀리초)
+
+// 변경분 출력 (주기 출력에서 변화한 센서만 전송)
+constexpr uint16_t DEFAULT_DELTA_DEADBAND_CENTI = 25;  // 0.25°C
+constexpr uint16_t MAX_DELTA_DEADBAND_CENTI = 1000;    // 10°C
+constexpr uint8_t DEFAULT_KEYFRAME_INTERVAL = 10;      // 측정 주기 N회마다 전체 출력
+
+// 설정 레코드에 저장되는 센서 슬롯 수
+constexpr uint8_t CONFIG_SENSOR_SLOTS = 8;
+
+// ROM 주소별 센서 설정 레코드 수 (일시적으로 분리된 센서 설정도 보존)
+constexpr uint8_t CONFIG_MAX_SENSOR_RECORDS = 16;
+constexpr uint8_t DEFAULT_SENSOR_RESOLUTION = 12; // bit
+
+// 주기 출력 형식 (설정 레코드에 저장)
+enum class OutputMode : uint8_t
+{
+    Table = 0,    // 사람이 읽는 상태 테이블 (기본)
+    Csv = 1,      // 센서당 CSV 한 줄
+    JsonLines = 2, // 측정 세트당 JSON 객체 한 줄
+    Binary = 3,    // COBS 프레임 바이너리 텔레메트리 (TelemetryProtocol.h)
+    Dashboard = 4  // ANSI 터미널 대시보드 (바뀐 칸만 다시 씀)
+};
+
+#pragma pack(push, 1)
+
+struct SensorThresholdConfig
+{
+    float upperThreshold; // TH (상한)
+    float lowerThreshold; // TL (하한)
+    uint8_t isCustomSet;  // 사용자 설정 여부
+};
+
+/**
+ * @brief 센서 1개의 설정 (64비트 ROM 주소로 식별)
+ */
+struct SensorConfigRecord
+{
+    uint64_t rom;              // 0: 빈 레코드
+    uint8_t logicalId;         // 0: 미할당, 1~8
+    uint8_t resolution;        // 9~12 bit
+    uint8_t isCustomSet;       // 임계값 사용자 설정 여부
+    float upperThreshold;      // TH (상한)
+    float lowerThreshold;      // TL (하한)
+    int16_t calibrationCenti;  // 측정값 보정 (0.01°C 단위)
+
+    void setDefaults(uint64_t romAddress)
+    {
+        rom = romAddress;
+        logicalId = 0;
+        resolution = DEFAULT_SENSOR_RESOLUTION;
+        isCustomSet = 0;
+        upperThreshold = DEFAULT_UPPER_THRESHOLD;
+        lowerThreshold = DEFAULT_LOWER_THRESHOLD;
+        calibrationCenti = 0;
+    }
+};
+
+/**
+ * @brief 영구 저장되는 시스템 설정 (packed)
+ *
+ * 필드는 항상 끝에만 추가한다. 이전 버전 레코드는 저장된 길이만큼만
+ * 복사되고 나머지 필드는 기본값을 유지하므로 자동으로 마이그레이션된다.
+ */
+struct SystemConfig
+{
+    // v1: 표시 행 기반 임계값 (v2부터는 ROM별 레코드로 이전하기 위한 용도로만 사용)
+    SensorThresholdConfig thresholds[CONFIG_SENSOR_SLOTS];
+    uint32_t measurementInterval; // 측정 주기 (밀리초)
+
+    // v2: ROM 주소별 센서 설정
+    uint8_t legacyRowThresholdsPending; // 1: thresholds[]를 다음 센서 검색 시 레코드로 이전
+    SensorConfigRecord sensorRecords[CONFIG_MAX_SENSOR_RECORDS];
+
+    // 마지막으로 확인된 버스 센서 목록 (빠른 부팅용, 검색 순서 유지)
+    uint8_t knownRomCount;
+    uint64_t knownRoms[CONFIG_SENSOR_SLOTS];
+
+    uint8_t outputMode; // OutputMode
+
+    // 변경분 출력 설정
+    uint8_t deltaReporting;       // 1: 변화한 센서만 주기 출력
+    uint16_t deltaDeadbandCenti;  // 이 폭(0.01°C)을 넘는 온도 변화만 출력
+    uint8_t keyframeInterval;     // 측정 주기 N회마다 전체 출력
+
+    void setDefaults()
+    {
+        for (uint8_t i = 0; i < CONFIG_SENSOR_SLOTS; ++i)
+        {
+            thresholds[i].upperThreshold = DEFAULT_UPPER_THRESHOLD;
+            thresholds[i].lowerThreshold = DEFAULT_LOWER_THRESHOLD;
+            thresholds[i].isCustomSet = 0;
+        }
+        measurementInterval = DEFAULT_MEASUREMENT_INTERVAL;
+        legacyRowThresholdsPending = 0;
+        for (uint8_t i = 0; i < CONFIG_MAX_SENSOR_RECORDS; ++i)
+        {
+            sensorRecords[i].setDefaults(0);
+        }
+        knownRomCount = 0;
+        for (uint8_t i = 0; i < CONFIG_SENSOR_SLOTS; ++i)
+        {
+            knownRoms[i] = 0;
+        }
+        outputMode = static_cast<uint8_t>(OutputMode::Table);
+        deltaReporting = 0;
+        deltaDeadbandCenti = DEFAULT_DELTA_DEADBAND_CENTI;
+        keyframeInterval = DEFAULT_KEYFRAME_INTERVAL;
+    }
+};
+
+#pragma pack(pop)
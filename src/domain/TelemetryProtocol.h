@@ -0,0 +1,107 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "Cobs.h"
+#include "Crc16.h"
+
+/**
+ * @brief 바이너리 텔레메트리 프레임 형식 (펌웨어와 호스트 디코더 공용)
+ *
+ * 프레임 = 0x00 + COBS( 헤더 + 본문 + CRC16(little endian) ) + 0x00
+ * - 앞쪽 0x00은 같은 포트에 섞인 텍스트를 끊어 수신 측이 바로 동기화하도록 함
+ * - 모든 다중 바이트 필드는 little endian
+ * - CRC는 CRC-16/CCITT-FALSE, 헤더와 본문 전체에 대해 계산
+ * - sequence는 프레임마다 1씩 증가 (수신 측에서 누락 프레임 검출)
+ * - 센서는 설정 레코드 슬롯 번호로 식별, 슬롯 → ROM 대응은 ROM_MAP 프레임으로 전송
+ */
+namespace Telemetry
+{
+constexpr uint8_t PROTOCOL_VERSION = 1;
+constexpr uint8_t MAX_SAMPLES = 16;
+
+enum FrameType : uint8_t
+{
+    FRAME_SAMPLES = 0x01, // 측정 세트 (TelemetrySample × count)
+    FRAME_ROM_MAP = 0x02, // 슬롯 → ROM 대응표 (TelemetryRomEntry × count)
+    FRAME_DELTA = 0x03,   // 변화한 센서만 포함한 측정 세트 (빠진 슬롯은 이전 값 유지)
+    FRAME_LOG = 0x04      // 추적 로그 레코드 (LogRecord × count, sequence = 첫 레코드 번호 하위 16비트)
+};
+
+// TelemetrySample::flags
+constexpr uint8_t FLAG_VALID = 0x01;       // 온도 값 유효
+constexpr uint8_t FLAG_STALE = 0x02;       // 리셋 이전 캐시 값
+constexpr uint8_t FLAG_UPPER_ALARM = 0x04; // 상한 초과
+constexpr uint8_t FLAG_LOWER_ALARM = 0x08; // 하한 미만
+constexpr uint8_t FLAG_REMOVED = 0x10;     // 버스에서 사라진 센서 (FRAME_DELTA)
+
+constexpr int16_t RAW_PER_DEGREE = 128; // raw 단위: 1/128°C (DallasTemperature raw와 동일)
+
+#pragma pack(push, 1)
+struct Header
+{
+    uint8_t version;
+    uint8_t type;
+    uint16_t sequence;
+    uint32_t timestampMs;
+    uint8_t count;
+};
+
+struct Sample
+{
+    uint8_t slot;
+    uint8_t flags;
+    int16_t raw;
+};
+
+struct RomEntry
+{
+    uint8_t slot;
+    uint8_t rom[8]; // 표시 순서 (rom[0] = family code)
+};
+
+constexpr uint8_t LOG_MAX_ARGS = 4;
+
+// 메시지 ID와 정수 인자만 담은 추적 로그 (문자열은 호스트에서 src/domain/LogCatalog.h로 조립)
+struct LogRecord
+{
+    uint32_t timestampMs;
+    uint16_t id;
+    uint8_t argCount;
+    int32_t args[LOG_MAX_ARGS];
+};
+#pragma pack(pop)
+
+constexpr size_t MAX_BODY_SIZE = (sizeof(Sample) > sizeof(RomEntry) ? sizeof(Sample) : sizeof(RomEntry)) * MAX_SAMPLES;
+constexpr uint8_t LOG_RECORDS_PER_FRAME = MAX_BODY_SIZE / sizeof(LogRecord);
+constexpr size_t MAX_PAYLOAD_SIZE = sizeof(Header) + MAX_BODY_SIZE + sizeof(uint16_t);
+constexpr size_t MAX_FRAME_SIZE = cobsMaxEncodedLength(MAX_PAYLOAD_SIZE) + 2;
+
+// payload(헤더+본문)에 CRC를 붙여 COBS 인코딩, 앞뒤 구분자까지 포함한 길이 반환
+// payload 버퍼는 CRC 2바이트를 덧붙일 여유가 있어야 함
+inline size_t encodeFrame(uint8_t *payload, size_t length, uint8_t *frame)
+{
+    uint16_t crc = crc16Ccitt(payload, length);
+    payload[length++] = static_cast<uint8_t>(crc & 0xFF);
+    payload[length++] = static_cast<uint8_t>(crc >> 8);
+
+    frame[0] = 0x00;
+    size_t encoded = 1 + cobsEncode(payload, length, frame + 1);
+    frame[encoded++] = 0x00;
+    return encoded;
+}
+
+// 앞뒤 구분자를 제외한 프레임을 디코딩하고 CRC 검사, 성공 시 CRC를 제외한 길이 반환 (실패 0)
+inline size_t decodeFrame(const uint8_t *frame, size_t length, uint8_t *payload, size_t capacity)
+{
+    size_t decoded = cobsDecode(frame, length, payload, capacity);
+    if (decoded < sizeof(Header) + sizeof(uint16_t))
+        return 0;
+
+    decoded -= sizeof(uint16_t);
+    uint16_t received = static_cast<uint16_t>(payload[decoded] | (payload[decoded + 1] << 8));
+    if (received != crc16Ccitt(payload, decoded))
+        return 0;
+    return decoded;
+}
+} // namespace Telemetry
@@ -0,0 +1,253 @@
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+#include "TextParse.h"
+#include "SystemConfig.h"
+
+namespace
+{
+char lower(char c)
+{
+    return static_cast<char>(tolower(static_cast<unsigned char>(c)));
+}
+
+bool isSpace(char c)
+{
+    return isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+bool isDigitChar(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// 측정 주기 한 구간 (숫자 × 단위)을 누적, 범위를 넘으면 false
+bool addIntervalPart(unsigned long &totalMs, long number, unsigned long multiplier)
+{
+    if (number <= 0)
+        return false; // 유효하지 않은 숫자
+
+    // 오버플로우 체크
+    if (static_cast<unsigned long>(number) > MAX_MEASUREMENT_INTERVAL / multiplier)
+        return false;
+
+    unsigned long partMs = static_cast<unsigned long>(number) * multiplier;
+
+    // 총합 오버플로우 체크
+    if (totalMs > MAX_MEASUREMENT_INTERVAL - partMs)
+        return false;
+
+    totalMs += partMs;
+    return true;
+}
+} // namespace
+
+namespace TextParse
+{
+std::string_view trim(std::string_view text)
+{
+    while (!text.empty() && isSpace(text.front()))
+        text.remove_prefix(1);
+    while (!text.empty() && isSpace(text.back()))
+        text.remove_suffix(1);
+    return text;
+}
+
+bool equalsIgnoreCase(std::string_view text, const char *other)
+{
+    std::string_view expected(other);
+    if (text.size() != expected.size())
+        return false;
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        if (lower(text[i]) != lower(expected[i]))
+            return false;
+    }
+    return true;
+}
+
+bool startsWithIgnoreCase(std::string_view text, const char *prefix)
+{
+    std::string_view expected(prefix);
+    return text.size() >= expected.size() && equalsIgnoreCase(text.substr(0, expected.size()), prefix);
+}
+
+long toLong(std::string_view text)
+{
+    size_t i = 0;
+    while (i < text.size() && isSpace(text[i]))
+        ++i;
+
+    bool negative = false;
+    if (i < text.size() && (text[i] == '+' || text[i] == '-'))
+    {
+        negative = text[i] == '-';
+        ++i;
+    }
+
+    // strtol처럼 범위를 넘으면 LONG_MAX / LONG_MIN으로 포화
+    unsigned long limit = negative ? static_cast<unsigned long>(LONG_MAX) + 1 : LONG_MAX;
+    unsigned long value = 0;
+    for (; i < text.size() && isDigitChar(text[i]); ++i)
+    {
+        unsigned long digit = static_cast<unsigned long>(text[i] - '0');
+        value = (value > (limit - digit) / 10) ? limit : value * 10 + digit;
+    }
+
+    if (!negative)
+        return static_cast<long>(value);
+    return value == limit ? LONG_MIN : -static_cast<long>(value);
+}
+
+float toFloat(std::string_view text)
+{
+    char buffer[33];
+    size_t length = text.size() < sizeof(buffer) - 1 ? text.size() : sizeof(buffer) - 1;
+    text.copy(buffer, length);
+    buffer[length] = '\0';
+    return static_cast<float>(atof(buffer));
+}
+
+unsigned long parseIntervalMs(std::string_view text)
+{
+    text = trim(text);
+    if (text.empty())
+        return 0; // 빈 입력
+
+    // 복합 단위 지원 (예: "1d2h30m", "2h30m", "30m45s"), 숫자 구간은 입력 안의 view로 보관
+    unsigned long totalMs = 0;
+    size_t numberStart = 0;
+    size_t numberLength = 0;
+
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        char c = lower(text[i]);
+
+        if (isDigitChar(c))
+        {
+            if (numberLength == 0)
+                numberStart = i;
+            ++numberLength;
+        }
+        else if (c == 'd' || c == 'h' || c == 'm' || c == 's')
+        {
+            if (numberLength == 0)
+                return 0; // 숫자 없이 단위만 있음
+
+            unsigned long multiplier = 1000; // 초
+            if (c == 'd')
+                multiplier = 24 * 60 * 60 * 1000UL; // 일
+            else if (c == 'h')
+                multiplier = 60 * 60 * 1000UL; // 시간
+            else if (c == 'm')
+                multiplier = 60 * 1000UL; // 분
+
+            if (!addIntervalPart(totalMs, toLong(text.substr(numberStart, numberLength)), multiplier))
+                return 0;
+            numberLength = 0;
+        }
+        else
+        {
+            return 0; // 유효하지 않은 문자
+        }
+    }
+
+    // 마지막에 숫자만 있고 단위가 없는 경우 (초로 처리)
+    if (numberLength > 0 && !addIntervalPart(totalMs, toLong(text.substr(numberStart, numberLength)), 1000))
+        return 0;
+
+    // 최소값 체크
+    if (totalMs < MIN_MEASUREMENT_INTERVAL)
+        return 0;
+
+    return totalMs;
+}
+
+std::string_view nextToken(std::string_view &text)
+{
+    text = trim(text);
+    size_t end = 0;
+    while (end < text.size() && !isSpace(text[end]))
+        ++end;
+    std::string_view token = text.substr(0, end);
+    text.remove_prefix(end);
+    return token;
+}
+
+bool parseInteger(std::string_view text, long &out)
+{
+    size_t i = (!text.empty() && (text[0] == '+' || text[0] == '-')) ? 1 : 0;
+    if (i == text.size())
+        return false;
+    for (size_t j = i; j < text.size(); ++j)
+    {
+        if (!isDigitChar(text[j]))
+            return false;
+    }
+    out = toLong(text);
+    return true;
+}
+
+bool parseDecimal(std::string_view text, float &out)
+{
+    size_t i = (!text.empty() && (text[0] == '+' || text[0] == '-')) ? 1 : 0;
+    size_t digits = 0;
+    bool point = false;
+    for (; i < text.size(); ++i)
+    {
+        if (isDigitChar(text[i]))
+            ++digits;
+        else if (text[i] == '.' && !point)
+            point = true;
+        else
+            return false;
+    }
+    if (digits == 0)
+        return false;
+    out = toFloat(text);
+    return true;
+}
+
+bool parseRomHex(std::string_view text, uint64_t &out)
+{
+    if (text.size() == 18 && text[0] == '0' && lower(text[1]) == 'x')
+        text.remove_prefix(2);
+    if (text.size() != 16)
+        return false;
+
+    uint64_t value = 0;
+    for (char c : text)
+    {
+        c = lower(c);
+        uint8_t nibble;
+        if (isDigitChar(c))
+            nibble = static_cast<uint8_t>(c - '0');
+        else if (c >= 'a' && c <= 'f')
+            nibble = static_cast<uint8_t>(c - 'a' + 10);
+        else
+            return false;
+        value = (value << 4) | nibble;
+    }
+    out = value;
+    return true;
+}
+
+uint8_t parseSensorIndices(std::string_view text, int *out, uint8_t capacity)
+{
+    bool used[9] = {false}; // 1~8만 사용
+    uint8_t count = 0;
+
+    for (char c : text)
+    {
+        if (c < '1' || c > '8')
+            continue;
+        int idx = c - '0';
+        if (!used[idx] && count < capacity)
+        {
+            out[count++] = idx;
+            used[idx] = true;
+        }
+    }
+    return count;
+}
+} // namespace TextParse
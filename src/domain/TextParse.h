@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief 할당 없는 입력 해석 함수 모음 (std::string_view 기반)
+ *
+ * 메뉴 입력을 String으로 복사·변환하지 않고 입력 버퍼를 그대로 가리키는 view로 해석한다.
+ * 숫자 변환은 Arduino String::toInt/toFloat(atol/atof)와 같은 결과를 낸다.
+ */
+namespace TextParse
+{
+// 앞뒤 공백 제거 (isspace 기준)
+std::string_view trim(std::string_view text);
+
+// 대소문자 무시 비교 (ASCII)
+bool equalsIgnoreCase(std::string_view text, const char *other);
+bool startsWithIgnoreCase(std::string_view text, const char *prefix);
+
+// atol과 같은 규칙: 앞 공백·부호 허용, 숫자가 아닌 문자에서 멈춤, 숫자가 없으면 0 (범위 밖은 포화)
+long toLong(std::string_view text);
+
+// atof와 같은 규칙 (짧은 스택 버퍼에 복사 후 변환, 32자를 넘는 부분은 무시)
+float toFloat(std::string_view text);
+
+// 측정 주기 입력 → ms ("30", "90s", "5m", "1h30m", "1d2h30m", 대소문자 무시)
+// 형식 오류이거나 MIN/MAX_MEASUREMENT_INTERVAL 범위 밖이면 0
+unsigned long parseIntervalMs(std::string_view text);
+
+// 공백으로 구분된 다음 단어를 반환하고 text에서 뗀다 (남은 단어가 없으면 빈 view)
+std::string_view nextToken(std::string_view &text);
+
+// 단어 전체가 숫자 형식일 때만 true (toLong/toFloat와 달리 뒤에 붙은 문자를 허용하지 않음)
+bool parseInteger(std::string_view text, long &out);  // "-10", "+5"
+bool parseDecimal(std::string_view text, float &out); // "35", "-3.25", ".5"
+
+// 16자리 16진수 ROM 주소 ("0x" 접두어 허용, 대소문자 무시)
+bool parseRomHex(std::string_view text, uint64_t &out);
+
+// 센서 번호 목록 ("1,3,5", "135" 등) → 1~8 숫자를 입력 순서대로 중복 없이 out에 기록, 개수 반환
+uint8_t parseSensorIndices(std::string_view text, int *out, uint8_t capacity);
+} // namespace TextParse
@@ -0,0 +1,319 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// 1로 빌드하면 UI 문구를 짧은 영어로 출력 (-D UI_TEXT_ENGLISH=1)
+#ifndef UI_TEXT_ENGLISH
+#define UI_TEXT_ENGLISH 0
+#endif
+
+/**
+ * @brief 사용자 표시 문구 테이블 (메시지 ID → 문자열)
+ *
+ * 메뉴/안내/오류 문구를 한 곳에서 관리한다. 각 항목은 X(ID, 한국어, 영어)이며,
+ * 빌드 시 UI_TEXT_ENGLISH에 따라 한 언어만 컴파일된다.
+ * 테이블과 ui()가 constexpr이므로 상수 ID 호출은 문자열 주소로 바로 치환되어
+ * 포인터 테이블도 RAM 사본도 만들어지지 않는다 (문자열은 .rodata, 즉 플래시에 위치).
+ *
+ * 표/대시보드 칸 문구(열 폭에 맞춘 문자열)와 CSV/JSON/프로토콜 문자열은 대상이 아니다.
+ */
+#define UI_TEXT_TABLE(X) \
+    /* 공통 */ \
+    X(SENSOR_PREFIX, "센서 ", "Sensor ") \
+    X(PROMPT_MENU_NUMBER, "메뉴 번호를 입력하세요: ", "Select: ") \
+    X(PROMPT_CONTINUE, "계속하시겠습니까? (y/n): ", "Continue? (y/n): ") \
+    X(MENU_HINT, "센서 제어 메뉴 진입: 'menu' 또는 'm' 입력", "Menu: type 'menu' or 'm'") \
+    X(CURRENT_INTERVAL, "현재 측정 주기: ", "Interval: ") \
+    X(ERR_CONFIG_SAVE, "❌ 오류: 설정 저장 실패", "❌ Config save failed") \
+    X(ERR_CONFIG_TABLE_FULL, "❌ 오류: 센서 설정 레코드가 가득 찼습니다", "❌ Sensor settings table full") \
+    X(ERR_INPUT_TOO_LONG, "Error: Input exceeds maximum length. Cleared.", "Error: Input exceeds maximum length. Cleared.") \
+    /* 부팅 */ \
+    X(BOOT_BANNER, "=== DS18B20 시스템 시작 ===", "=== DS18B20 system start ===") \
+    X(BOOT_STEP_SERIAL, "1. 시리얼 통신 초기화 완료", "1. Serial ready") \
+    X(BOOT_STEP_SENSORS, "2. 센서 및 EEPROM 초기화 완료", "2. Sensors and EEPROM ready") \
+    X(BOOT_STEP_MENU, "3. 메뉴 컨트롤러 초기화 완료", "3. Menu ready") \
+    X(BOOT_DONE, "=== 시스템 초기화 완료 ===", "=== Init complete ===") \
+    X(SENSORS_INITIALIZING, "DS18B20 센서 초기화 중...", "Initializing DS18B20...") \
+    X(WARM_RESTORED, "리셋 이전 측정값 복원 (새 측정 전까지 * 표시)", "Restored pre-reset readings (* until next reading)") \
+    X(STATUS_NORMAL, "시스템 상태: Normal 모드", "Status: Normal mode") \
+    X(CURRENT_APP_STATE, "현재 AppState: ", "AppState: ") \
+    X(CONFIG_LOADING, "설정 로드 중...", "Loading config...") \
+    X(CONFIG_LOADED, " 완료 (seq ", " done (seq ") \
+    X(CONFIG_MIGRATED_LEGACY, "💾 이전 EEPROM 레이아웃에서 설정을 이전했습니다.", "💾 Migrated settings from the legacy EEPROM layout.") \
+    X(CONFIG_UPGRADED, "💾 이전 버전 설정 레코드를 변환했습니다.", "💾 Upgraded config record from an older version.") \
+    X(CONFIG_DEFAULTS, "💾 저장된 설정이 없어 기본값을 사용합니다.", "💾 No saved config, using defaults.") \
+    X(ROSTER_RESTORED, " 저장된 센서 목록 확인 완료 (", " saved roster confirmed (") \
+    X(ROSTER_RESTORED_END, "개, 전체 검색은 백그라운드 진행)", ", full search in background)") \
+    X(DISCOVERY_DONE, " 전체 검색 완료", " full search done") \
+    X(FIRST_READING, "⏱️ 부팅 후 첫 유효 측정: ", "⏱️ First valid reading after boot: ") \
+    X(FIRST_READING_CACHED, " ms (저장된 센서 목록)", " ms (saved roster)") \
+    X(FIRST_READING_SEARCH, " ms (전체 검색)", " ms (full search)") \
+    /* 메인 메뉴 / 명령 */ \
+    X(MENU_TITLE, "===== 센서 제어 메뉴 =====", "===== Sensor menu =====") \
+    X(MENU_ITEM_SENSOR_ID, "1. 센서 ID 조정", "1. Sensor IDs") \
+    X(MENU_ITEM_THRESHOLD, "2. 상/하한 온도 조정", "2. Thresholds") \
+    X(MENU_ITEM_INTERVAL, "3. 센서 측정 주기 조정", "3. Measurement interval") \
+    X(MENU_ITEM_EXIT, "4. 취소 / 상태창으로 돌아가기", "4. Cancel / back to status") \
+    X(ERR_MENU_1_4, "지원하지 않는 메뉴입니다. 1~4 중 선택하세요.", "Invalid choice, enter 1~4.") \
+    X(ERR_MENU_1_5, "지원하지 않는 메뉴입니다. 1~5 중 선택하세요.", "Invalid choice, enter 1~5.") \
+    X(ERR_MENU_1_6, "지원하지 않는 메뉴입니다. 1~6 중 선택하세요.", "Invalid choice, enter 1~6.") \
+    X(SYSTEM_READY, "[시스템 준비 완료 - Normal 모드에서 대기 중]", "[Ready - Normal mode]") \
+    X(FORCE_RESET, "[INFO] 강제 리셋 명령어 수신", "[INFO] Reset command received") \
+    X(WARN_UNKNOWN_STATE, "[경고] 알 수 없는 상태 감지, Normal 상태로 리셋합니다.", "[warn] Unknown state, back to Normal.") \
+    X(CURRENT_OUTPUT_MODE, "현재 출력 형식: ", "Output mode: ") \
+    X(USAGE_MODE, "사용법: mode table | mode csv | mode json | mode bin | mode dash", "Usage: mode table | mode csv | mode json | mode bin | mode dash") \
+    X(ERR_UNSUPPORTED_MODE, "❌ 오류: 지원하지 않는 출력 형식입니다 (table, csv, json, bin, dash)", "❌ Unsupported mode (table, csv, json, bin, dash)") \
+    X(OUTPUT_MODE_SET, "✅ 출력 형식: ", "✅ Output mode: ") \
+    X(BAUD_NOTHING_PENDING, "ℹ️ 확인 대기 중인 속도 변경이 없습니다.", "ℹ️ No baud change pending.") \
+    X(BAUD_CONFIRMED, "✅ 통신 속도 확정: ", "✅ Baud confirmed: ") \
+    X(CURRENT_BAUD, "현재 통신 속도: ", "Baud: ") \
+    X(USAGE_BAUD, "사용법: baud <115200|230400|460800|921600|1000000|2000000>, 변경 후 새 속도에서 baudok", "Usage: baud <115200|230400|460800|921600|1000000|2000000>, then baudok at the new rate") \
+    X(ERR_UNSUPPORTED_BAUD, "❌ 오류: 지원하지 않는 통신 속도입니다.", "❌ Unsupported baud rate.") \
+    X(BAUD_REVERTED, "⚠️ 통신 속도 확인 없음, 복귀: ", "⚠️ Baud not confirmed, reverted: ") \
+    X(ERR_DEADBAND_RANGE, "❌ 오류: 데드밴드는 0~", "❌ Deadband must be 0~") \
+    X(DEADBAND_RANGE_UNIT, " (0.01°C 단위)로 입력하세요.", " (0.01°C units).") \
+    X(ERR_KEYFRAME_RANGE, "❌ 오류: 전체 출력 주기는 1~255회로 입력하세요.", "❌ Keyframe interval must be 1~255.") \
+    X(USAGE_DELTA, "❌ 오류: 사용법: delta on | delta off | delta db <0.01°C> | delta kf <횟수>", "❌ Usage: delta on | delta off | delta db <0.01°C> | delta kf <count>") \
+    X(DELTA_STATUS, "변경분 출력: ", "Delta: ") \
+    X(DELTA_DEADBAND, ", 데드밴드 ", ", deadband ") \
+    X(DELTA_KEYFRAME, "°C, 전체 출력 ", "°C, keyframe every ") \
+    X(DELTA_KEYFRAME_UNIT, "회마다", " reports") \
+    /* 송신 큐 / 진단 */ \
+    X(TXQ_TITLE, "=== 송신 큐 ===", "=== TX queue ===") \
+    X(TXQ_POLICY, "넘침 정책: ", "Overflow: ") \
+    X(TXQ_POLICY_OLDEST, "오래된 줄 버림 (oldest)", "drop oldest") \
+    X(TXQ_POLICY_NEW, "새 출력 버림 (new)", "drop new") \
+    X(TXQ_LANE_BULK, "일반", "bulk") \
+    X(TXQ_LANE_PRIORITY, "우선순위", "priority") \
+    X(TXQ_SENT, ": 전송 ", ": sent ") \
+    X(TXQ_HIGH_WATER, " B, 최대 대기 ", " B, peak ") \
+    X(TXQ_DROPPED_NEW, " B, 버림(새 출력) ", " B, dropped new ") \
+    X(TXQ_DROPPED_OLD, " B, 버림(오래된 줄) ", " B, dropped old ") \
+    X(RXQ_RECEIVED, "수신: 받음 ", "RX: received ") \
+    X(RXQ_LINES, " B, 줄 ", " B, lines ") \
+    X(RXQ_HIGH_WATER, ", 최대 대기 ", ", peak ") \
+    X(RXQ_PEAK_LINES, " B / ", " B / ") \
+    X(RXQ_OVERLONG, "줄, 길이 초과 ", " lines, overlong ") \
+    X(RXQ_STALLED, ", 읽기 보류 ", ", stalled polls ") \
+    X(USAGE_TXQ, "❌ 오류: 사용법: txq | txq new | txq oldest", "❌ Usage: txq | txq new | txq oldest") \
+    /* 추적 로그 */ \
+    X(TRACE_RECORDED, "추적 로그: 기록 ", "Trace: recorded ") \
+    X(TRACE_STORED, "건, 보관 ", ", stored ") \
+    X(TRACE_OVERWRITTEN, "건, 덮어씀 ", ", overwritten ") \
+    X(TRACE_COUNT_SUFFIX, "건", "") \
+    X(TRACE_CLEARED, "추적 로그를 비웠습니다", "Trace cleared") \
+    X(USAGE_TRACE, "❌ 오류: 사용법: trace | trace clear", "❌ Usage: trace | trace clear") \
+    /* 보존 로그 */ \
+    X(BOOT_CRASHLOG_FOUND, "이전 세션 로그 ", "Previous session log: ") \
+    X(BOOT_CRASHLOG_HINT, "줄 보존됨 ('crashlog'로 조회)", " lines kept (see 'crashlog')") \
+    X(CRASHLOG_TITLE, "=== 보존 로그 (세션 ", "=== Retained log (session ") \
+    X(CRASHLOG_TITLE_END, ") ===", ") ===") \
+    X(CRASHLOG_PREVIOUS, "[이전] ", "[prev] ") \
+    X(CRASHLOG_EMPTY, "(기록 없음)", "(empty)") \
+    X(CRASHLOG_CORRUPT, "⚠️ 손상된 레코드에서 중단", "⚠️ Stopped at a corrupt record") \
+    X(CRASHLOG_CLEARED, "보존 로그를 비웠습니다", "Retained log cleared") \
+    X(USAGE_CRASHLOG, "❌ 오류: 사용법: crashlog | crashlog clear", "❌ Usage: crashlog | crashlog clear") \
+    X(MEM_TITLE, "=== 메모리 (loop() 작업 영역 / 힙 할당) ===", "=== Memory (loop scratch arena / heap) ===") \
+    X(MEM_ARENA, "작업 영역: 최대 ", "Arena: peak ") \
+    X(MEM_ARENA_FAILED, " B, 부족 ", " B, out of space ") \
+    X(MEM_COUNT_SUFFIX, "회", "") \
+    X(MEM_ALLOC_TOTAL, "malloc 호출: 전체 ", "malloc calls: total ") \
+    X(MEM_ALLOC_STEADY, "회, 정상 동작 중 ", ", steady state ") \
+    X(MEM_ALLOC_CYCLES, "회 (loop ", " (loops: ") \
+    X(MEM_ALLOC_CYCLES_END, "회)", ")") \
+    X(MEM_ALLOC_DISABLED, "malloc 계측 꺼짐 (-D ALLOC_COUNTER_ENABLED=1, README 참고)", "malloc counting off (-D ALLOC_COUNTER_ENABLED=1, see README)") \
+    X(RENDER_TITLE, "=== 상태 테이블 출력 비용 (마지막 1회, 변환 대기 제외) ===", "=== Table render cost (last, excl. conversion) ===") \
+    X(RENDER_BYTES, "출력 바이트: ", "Bytes: ") \
+    X(RENDER_LINES, " B, 줄 수: ", " B, lines: ") \
+    X(RENDER_WRITES, " (write 호출 ", " (writes: ") \
+    X(RENDER_WRITES_END, "회)", ")") \
+    X(RENDER_CYCLES, "CPU 사이클: ", "CPU cycles: ") \
+    X(RENDER_TRUNCATED, "⚠️ 잘린 줄: ", "⚠️ Truncated lines: ") \
+    X(BOOT_TITLE, "=== 부팅 시간 (", "=== Boot timing (") \
+    X(BOOT_FAST, "빠른 부팅", "fast boot") \
+    X(BOOT_FULL, "기본 부팅", "full boot") \
+    X(BOOT_TITLE_END, ", 리셋 기준 ms) ===", ", ms since reset) ===") \
+    X(BOOT_SERIAL, "시리얼 초기화: ", "Serial ready:   ") \
+    X(BOOT_CONFIG, "설정 로드:     ", "Config loaded:  ") \
+    X(BOOT_SENSORS, "센서 목록 확보: ", "Sensors ready:  ") \
+    X(BOOT_SETUP, "setup 완료:    ", "setup done:     ") \
+    X(BOOT_FIRST_READING, "첫 유효 측정:   ", "First reading:  ") \
+    X(BOOT_WAITING, "대기 중", "pending") \
+    /* 센서 ID 메뉴 */ \
+    X(ID_MENU_TITLE, "--- 센서 ID 조정 메뉴 ---", "--- Sensor IDs ---") \
+    X(ID_MENU_SINGLE, "1. 개별 센서 ID 변경", "1. Change one") \
+    X(ID_MENU_MULTI, "2. 복수의 센서 ID 변경", "2. Change several") \
+    X(ID_MENU_AUTO, "3. 주소순 자동 ID 할당", "3. Auto-assign by address") \
+    X(ID_MENU_RESET, "4. 전체 ID 초기화", "4. Clear all") \
+    X(ID_MENU_BACK, "5. 이전 메뉴 이동", "5. Back") \
+    X(ID_MENU_STATUS, "6. 상태창으로 돌아가기", "6. Back to status") \
+    X(ID_SINGLE_TITLE, "[개별 센서 ID 변경] 센서 상태창:", "[Change one sensor ID] Status:") \
+    X(ID_MULTI_TITLE, "[복수 센서 ID 변경] 센서 상태창:", "[Change several sensor IDs] Status:") \
+    X(PROMPT_SELECT_SENSOR, "변경할 센서 번호(1~8, 취소:c) 입력: ", "Sensor number (1~8, c=cancel): ") \
+    X(PROMPT_SELECT_SENSORS, "변경할 센서 번호들을 입력하세요 (예: 1 2 3, 취소:c): ", "Sensor numbers (e.g. 1 2 3, c=cancel): ") \
+    X(PROMPT_SENSOR_LIST, "변경할 센서 번호를 입력하세요 (예: 1,3,5 또는 135):", "Sensor numbers (e.g. 1,3,5 or 135):") \
+    X(ID_AUTO_ASSIGNED, "[자동] 주소순 ID 할당 완료", "[auto] IDs assigned by address") \
+    X(WARN_RESET_ALL_IDS, "⚠️  경고: 모든 센서의 ID가 초기화됩니다!", "⚠️  All sensor IDs will be cleared!") \
+    X(PROMPT_RESET_ALL_IDS, "모든 센서의 ID를 초기화하시겠습니까? (y/n): ", "Clear all sensor IDs? (y/n): ") \
+    X(RESET_IDS_CANCELLED, "전체 ID 초기화가 취소되었습니다.", "ID reset cancelled.") \
+    X(ERR_SENSOR_NUMBERS_ONLY, "[오류] 1~8 사이의 숫자와 공백만 입력하세요.", "[error] Use digits 1~8 and spaces only.") \
+    X(ERR_NO_VALID_SENSOR_TAG, "[오류] 유효한 센서 번호가 없습니다.", "[error] No valid sensor number.") \
+    X(ERR_INVALID_SENSORS, "[오류] 연결되지 않았거나 잘못된 센서 번호: ", "[error] Not connected or invalid: ") \
+    X(ERR_NO_SENSOR_SELECTED, "[오류] 선택된 센서가 없습니다.", "[error] No sensor selected.") \
+    X(ERR_ID_RANGE_TAG, "[오류] ID는 1~8 사이의 숫자여야 합니다.", "[error] ID must be 1~8.") \
+    X(ERR_ID_IN_USE_TAG, "[오류] 이미 사용 중인 ID입니다.", "[error] ID already in use.") \
+    X(ERR_NO_VALID_SENSOR, "오류: 유효한 센서 번호가 없습니다.", "Error: no valid sensor number.") \
+    X(ERR_TOO_MANY_SENSORS, "오류: 너무 많은 센서가 선택되었습니다.", "Error: too many sensors selected.") \
+    X(ERR_ID_RANGE, "오류: ID는 1~8 사이여야 합니다.", "Error: ID must be 1~8.") \
+    X(ERR_ID_IN_USE, "오류: 이미 사용 중인 ID입니다.", "Error: ID already in use.") \
+    X(SELECTED_SENSOR_NUMBERS, "선택된 센서 번호: ", "Selected: ") \
+    X(SELECTED_SENSORS, "선택된 센서: ", "Selected: ") \
+    X(CONFIRM_CHANGE_SENSOR, "번을 변경할까요? (y/n, 취소:c)", ": change? (y/n, c=cancel)") \
+    X(CONFIRM_INVALID_YNC, "y(예), n(아니오), c(취소) 중 하나를 입력하세요.", "Enter y, n or c.") \
+    X(CONFIRM_INVALID_YN, "y(예) 또는 n(아니오)를 입력하세요.", "Enter y or n.") \
+    X(PROMPT_NEW_ID, "의 새로운 ID(1~8, 취소:c)를 입력하세요: ", " new ID (1~8, c=cancel): ") \
+    X(PROMPT_NEW_ID_SHORT, "의 새 ID (1-8)를 입력하세요: ", " new ID (1-8): ") \
+    X(ID_CHANGED_TO, "의 ID를 ", " ID -> ") \
+    X(ID_CHANGED_DONE, "(으)로 변경 완료", " done") \
+    X(ID_CHANGED_SUFFIX, "로 변경했습니다.", " done.") \
+    X(CURRENT_ID_PREFIX, " (현재 ID: ", " (ID: ") \
+    X(RESET_IDS_TITLE, "=== 전체 센서 ID 초기화 시작 ===", "=== Clearing all sensor IDs ===") \
+    X(NO_SENSORS, "연결된 센서가 없습니다.", "No sensors connected.") \
+    X(TOTAL_PREFIX, "총 ", "Clearing ") \
+    X(RESET_IDS_COUNT, "개의 센서 ID를 초기화합니다...", " sensor IDs...") \
+    X(PREV_ID_PREFIX, " (기존 ID: ", " (was ID ") \
+    X(RESET_TO_UNASSIGNED, ") → 미할당 상태로 초기화", ") -> unassigned") \
+    X(ALREADY_UNASSIGNED, " → 이미 미할당 상태 (건너뜀)", " -> already unassigned (skipped)") \
+    X(RESET_DONE_PREFIX, "초기화 완료: ", "Cleared: ") \
+    X(RESET_IDS_DONE_COUNT, "개 센서 ID가 초기화되었습니다.", " sensor IDs.") \
+    X(RESET_IDS_DONE, "=== 전체 센서 ID 초기화 완료 ===", "=== All sensor IDs cleared ===") \
+    X(ERR_CONFIG_NO_ROOM, "❌ 오류: 센서 설정을 저장할 공간이 없습니다", "❌ No room for sensor settings") \
+    /* 임계값 메뉴 */ \
+    X(THRESHOLD_MENU_TITLE, "===== 상/하한 온도 조정 메뉴 =====", "===== Thresholds =====") \
+    X(THRESHOLD_MENU_SINGLE, "1. 개별 센서 임계값 설정", "1. One sensor") \
+    X(THRESHOLD_MENU_MULTI, "2. 복수 센서 임계값 설정", "2. Several sensors") \
+    X(THRESHOLD_MENU_RESET, "3. 전체 센서 임계값 초기화", "3. Reset all") \
+    X(THRESHOLD_MENU_BACK, "4. 이전 메뉴로 돌아가기", "4. Back") \
+    X(THRESHOLD_MENU_STATUS, "5. 상태창으로 돌아가기", "5. Back to status") \
+    X(THRESHOLD_OVERVIEW_TITLE, "=== 센서별 임계값 현황 ===", "=== Thresholds per sensor ===") \
+    X(MULTI_THRESHOLD_TITLE, "=== 복수 센서 임계값 설정 ===", "=== Thresholds for several sensors ===") \
+    X(PROMPT_THRESHOLD_SENSOR, "임계값을 설정할 센서 번호(1~8, 취소:c)를 입력하세요: ", "Sensor number (1~8, c=cancel): ") \
+    X(PROMPT_THRESHOLD_SENSORS, "임계값을 설정할 센서 번호들을 입력하세요 (예: 1 2 3 5, 취소:c): ", "Sensor numbers (e.g. 1 2 3 5, c=cancel): ") \
+    X(WARN_RESET_ALL_THRESHOLDS, "⚠️  경고: 모든 센서의 임계값이 기본값으로 초기화됩니다!", "⚠️  All thresholds will be reset to defaults!") \
+    X(ERR_ROW_NOT_CONNECTED, "❌ 오류: 해당 행에 연결된 센서가 없습니다", "❌ No sensor on that row") \
+    X(ERR_SENSOR_NUMBER_RANGE, "❌ 오류: 1~8 사이의 숫자를 입력하세요.", "❌ Enter a number 1~8.") \
+    X(STATS_SENSOR_PREFIX, "📊 센서 ", "📊 Sensor ") \
+    X(CURRENT_THRESHOLDS, "번 현재 임계값:", " thresholds:") \
+    X(LABEL_UPPER_TH, "   상한(TH): ", "   TH: ") \
+    X(LABEL_LOWER_TL, "   하한(TL): ", "   TL: ") \
+    X(PROMPT_NEW_UPPER, "새로운 상한 임계값 입력 (현재: ", "New TH (now ") \
+    X(PROMPT_NEW_LOWER, "새로운 하한 임계값 입력 (현재: ", "New TL (now ") \
+    X(PROMPT_UPPER, "상한 임계값 입력 (현재: ", "TH (now ") \
+    X(PROMPT_LOWER, "하한 임계값 입력 (현재: ", "TL (now ") \
+    X(PROMPT_LOWER_AGAIN, "하한 임계값을 다시 입력하세요 (현재: ", "Re-enter TL (now ") \
+    X(PROMPT_THRESHOLD_RANGE, "°C, 범위: -55~125°C, 엔터=유지): ", "°C, -55~125°C, Enter=keep): ") \
+    X(UPPER_KEPT, "상한값 유지: ", "TH kept: ") \
+    X(LOWER_KEPT, "하한값 유지: ", "TL kept: ") \
+    X(UPPER_SET, "상한값 설정: ", "TH set: ") \
+    X(LOWER_SET, "하한값 설정: ", "TL set: ") \
+    X(ERR_NUMBER_UPPER, "❌ 오류: 유효한 숫자를 입력하세요 (예: 25.5)", "❌ Enter a number (e.g. 25.5)") \
+    X(ERR_NUMBER_LOWER, "❌ 오류: 유효한 숫자를 입력하세요 (예: 15.5)", "❌ Enter a number (e.g. 15.5)") \
+    X(WARN_DS18B20_RANGE, "❌ 경고: DS18B20 범위를 벗어났습니다 (-55~125°C)", "❌ Outside DS18B20 range (-55~125°C)") \
+    X(WARN_UPPER_NOT_ABOVE_LOWER, "❌ 경고: 상한값은 하한값보다 커야 합니다", "❌ TH must be above TL") \
+    X(LABEL_UPPER, "상한: ", "TH: ") \
+    X(LABEL_LOWER_NEXT, "°C, 하한: ", "°C, TL: ") \
+    X(PROMPT_SAME_THRESHOLDS, "이 센서들에 동일한 임계값을 설정하시겠습니까? (y/n, 취소:c): ", "Apply the same thresholds to these? (y/n, c=cancel): ") \
+    X(MULTI_THRESHOLD_HEADER, "📊 복수 센서 임계값 설정 (", "📊 Thresholds for ") \
+    X(MULTI_THRESHOLD_HEADER_END, "개 센서)", " sensors)") \
+    X(MULTI_THRESHOLD_APPLYING, "🔄 복수 센서 임계값 설정 중...", "🔄 Applying thresholds...") \
+    X(WARN_SENSOR_PREFIX, "⚠️ 센서 ", "⚠️ Sensor ") \
+    X(SKIP_EMPTY_ROW, "번 행에 연결된 센서가 없어 건너뜁니다", ": no sensor on that row, skipped") \
+    X(MULTI_THRESHOLD_DONE, "개 센서 임계값 설정 완료: TH=", " sensors set: TH=") \
+    X(SENSORS_APPLIED, "설정된 센서: ", "Applied to: ") \
+    X(ERR_BAD_ROM, "❌ 오류: 잘못된 센서 주소", "❌ Invalid sensor address") \
+    X(ERR_TEMP_RANGE, "❌ 오류: 온도 범위를 벗어났습니다 (-55~125°C)", "❌ Temperature out of range (-55~125°C)") \
+    X(ERR_UPPER_NOT_ABOVE_LOWER, "❌ 오류: 상한값은 하한값보다 커야 합니다", "❌ TH must be above TL") \
+    X(ERR_RESOLUTION, "❌ 오류: 분해능은 9~12비트만 지원합니다", "❌ Resolution must be 9~12 bits") \
+    X(ERR_CALIBRATION, "❌ 오류: 보정값은 -5.0~5.0°C 범위여야 합니다", "❌ Offset must be -5.0~5.0°C") \
+    X(DONE_SENSOR_PREFIX, "✅ 센서 ", "✅ Sensor ") \
+    X(THRESHOLDS_SET, " 임계값 설정 완료: ", " thresholds set: ") \
+    X(RESET_SENSOR_PREFIX, "🔄 센서 ", "🔄 Sensor ") \
+    X(THRESHOLDS_RESET, " 임계값이 기본값으로 초기화되었습니다", " thresholds reset to defaults") \
+    X(RESET_THRESHOLDS_TITLE, "=== 전체 센서 임계값 초기화 시작 ===", "=== Resetting all thresholds ===") \
+    X(RESET_THRESHOLDS_DONE, "=== 전체 센서 임계값 초기화 완료 ===", "=== All thresholds reset ===") \
+    X(LEGACY_ROWS_MIGRATED, "💾 표시 행 기반 임계값을 센서 주소별 설정으로 이전했습니다.", "💾 Row-based thresholds moved to per-sensor settings.") \
+    X(EEPROM_SAVE_SENSOR, "💾 EEPROM 저장 - 센서 ", "💾 EEPROM save - sensor ") \
+    X(EEPROM_BATCH_QUEUED, "💾 EEPROM 저장 - 일괄 커밋 예약", "💾 EEPROM save - batch queued") \
+    X(EEPROM_WRITTEN, "💾 EEPROM 기록 완료 (seq ", "💾 EEPROM written (seq ") \
+    /* 측정 주기 메뉴 */ \
+    X(INTERVAL_MENU_TITLE, "===== 센서 측정 주기 조정 메뉴 =====", "===== Measurement interval =====") \
+    X(INTERVAL_RANGE, "설정 가능 범위: 10초 ~ 30일 (1초 단위)", "Range: 10 s ~ 30 days (1 s steps)") \
+    X(INTERVAL_EXAMPLES_TITLE, "입력 형식 예시:", "Examples:") \
+    X(INTERVAL_EXAMPLE_SECONDS, "  - 초 단위: 30, 30s (30초)", "  - seconds: 30, 30s") \
+    X(INTERVAL_EXAMPLE_MINUTES, "  - 분 단위: 5m, 5M (5분)", "  - minutes: 5m, 5M") \
+    X(INTERVAL_EXAMPLE_HOURS, "  - 시간 단위: 2h, 2H (2시간)", "  - hours: 2h, 2H") \
+    X(INTERVAL_EXAMPLE_DAYS, "  - 일 단위: 1d, 1D (1일)", "  - days: 1d, 1D") \
+    X(INTERVAL_EXAMPLE_MIXED_DAYS, "  - 복합 단위: 1d2h30m (1일 2시간 30분)", "  - mixed: 1d2h30m") \
+    X(INTERVAL_EXAMPLE_MIXED_HOURS, "  - 복합 단위: 2h30m45s (2시간 30분 45초)", "  - mixed: 2h30m45s") \
+    X(INTERVAL_CASE_NOTE, "※ 대소문자 구분 없음", "(case-insensitive)") \
+    X(PROMPT_INTERVAL, "새로운 측정 주기를 입력하세요 (취소:c): ", "New interval (c=cancel): ") \
+    X(ERR_INTERVAL_FORMAT, "❌ 오류: 유효하지 않은 입력 형식입니다.", "❌ Invalid format.") \
+    X(INTERVAL_HINT_SIMPLE, "예시: 30 (30초), 5m (5분), 2h (2시간), 1d (1일)", "e.g. 30, 5m, 2h, 1d") \
+    X(INTERVAL_HINT_MIXED, "복합: 1d2h30m (1일 2시간 30분), 2h30m45s (2시간 30분 45초)", "mixed: 1d2h30m, 2h30m45s") \
+    X(ERR_INTERVAL_RANGE_MENU, "❌ 오류: 측정 주기 범위를 벗어났습니다 (10초 ~ 30일)", "❌ Interval out of range (10 s ~ 30 days)") \
+    X(ERR_INTERVAL_RANGE, "❌ 오류: 측정 주기 범위를 벗어났습니다", "❌ Interval out of range") \
+    X(INTERVAL_CHANGE_TITLE, "📊 측정 주기 변경 사항:", "📊 Interval changed:") \
+    X(INTERVAL_NEW, "  새로운 주기: ", "  New: ") \
+    X(INTERVAL_APPLIES_NEXT, "  다음 센서 상태 업데이트부터 새로운 주기가 적용됩니다.", "  Applies from the next status update.") \
+    X(INTERVAL_SET, "✅ 측정 주기 설정 완료: ", "✅ Interval set: ") \
+    X(EEPROM_SAVE_INTERVAL, "💾 EEPROM 저장 - 측정 주기: ", "💾 EEPROM save - interval: ") \
+    /* 상태 테이블 / 경보 */ \
+    X(ROSTER_CHANGED, "🔍 센서 구성 변경 감지: ", "🔍 Sensor set changed: ") \
+    X(ROSTER_COUNT_ARROW, "개 → ", " -> ") \
+    X(COUNT_SUFFIX, "개", "") \
+    X(REMOVED_ROW, " | 연결 끊김 (버스에서 사라짐)", " | disconnected (gone from bus)") \
+    X(ID_ERROR_WARNING, "[경고] 유효하지 않은 센서 ID(1~8 범위 밖) 감지: 센서 번호/주소: ", "[warn] Invalid sensor ID (outside 1~8): number/address: ") \
+    X(ID_ERROR_HINT, "각 센서의 논리 ID는 반드시 1~8 범위여야 합니다. 메뉴에서 ID를 재설정하세요.", "Sensor IDs must be 1~8. Reassign them in the menu.") \
+    X(DELTA_NOTE, "(변경된 센서만 표시, 전체 표는 측정 ", "(changed sensors only, full table every ") \
+    X(DELTA_NOTE_END, "회마다)", " reports)") \
+    X(WARM_NOTE, "* 리셋 이전 측정값입니다 (새 측정 대기 중)", "* Values from before reset (waiting for new reading)") \
+    X(MENU_HINT_DETAIL, "(센서 ID/임계값/상태 관리 등은 메뉴에서 설정 가능)", "(sensor IDs, thresholds and more)") \
+    X(ALARM_UPPER, "🚨 [경보] 상한 초과: ID ", "🚨 [ALARM] above TH: ID ") \
+    X(ALARM_LOWER, "🚨 [경보] 하한 미만: ID ", "🚨 [ALARM] below TL: ID ") \
+    X(ALARM_CLEARED, "✅ [경보 해제] ", "✅ [CLEAR] ") \
+    X(ALARM_UPPER_NAME, "상한", "TH") \
+    X(ALARM_LOWER_NAME, "하한", "TL") \
+    X(ALARM_BACK_TO_NORMAL, " 정상 복귀: ID ", " back to normal: ID ") \
+    /* 측정 주기 단위 (Format::interval) */ \
+    X(UNIT_DAY, "일", "d") \
+    X(UNIT_HOUR, "시간", "h") \
+    X(UNIT_MINUTE, "분", "m") \
+    X(UNIT_SECOND, "초", "s")
+
+enum class UiText : uint16_t
+{
+#define UI_TEXT_ID(id, ko, en) id,
+    UI_TEXT_TABLE(UI_TEXT_ID)
+#undef UI_TEXT_ID
+    COUNT
+};
+
+namespace UiTextTable
+{
+#if UI_TEXT_ENGLISH
+#define UI_TEXT_ENTRY(id, ko, en) en,
+#else
+#define UI_TEXT_ENTRY(id, ko, en) ko,
+#endif
+// const 포인터의 constexpr 배열: 실행 중 인덱스로 접근해도 테이블은 .rodata에 놓인다
+constexpr const char *const TEXT[] = {UI_TEXT_TABLE(UI_TEXT_ENTRY)};
+#undef UI_TEXT_ENTRY
+
+static_assert(sizeof(TEXT) / sizeof(TEXT[0]) == static_cast<size_t>(UiText::COUNT), "UI text table size mismatch");
+} // namespace UiTextTable
+
+// 메시지 ID → 현재 언어 문자열
+constexpr const char *ui(UiText id)
+{
+    return UiTextTable::TEXT[static_cast<size_t>(id)];
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Crc16.h"
+
+constexpr uint8_t WARM_START_MAX_ENTRIES = 8;
+
+// 알람 상태 비트
+constexpr uint8_t WARM_ALARM_UPPER = 0x01; // 상한 초과
+constexpr uint8_t WARM_ALARM_LOWER = 0x02; // 하한 미만
+
+#pragma pack(push, 1)
+
+/**
+ * @brief 센서 1개의 마지막 측정값과 누적 통계 (온도는 0.01°C 단위)
+ */
+struct WarmStartEntry
+{
+    uint64_t rom;
+    int16_t tempCenti;
+    int16_t minCenti;
+    int16_t maxCenti;
+    uint32_t sampleCount;
+    uint8_t alarmFlags;
+};
+
+/**
+ * @brief 리셋 후에도 유지되는 마지막 측정 캐시 (.noinit RAM 영역에 배치)
+ *
+ * 전원 인가 시 RAM 내용은 임의 값이므로 magic과 CRC가 모두 맞을 때만 유효하다.
+ * generation은 부팅할 때마다 증가하며, sampleGeneration과 다르면
+ * 저장된 측정값은 리셋 이전 값(stale)이다.
+ */
+struct WarmStartCache
+{
+    static constexpr uint32_t MAGIC = 0x57534331; // "WSC1"
+
+    uint32_t magic;
+    uint32_t generation;
+    uint32_t sampleGeneration;
+    uint8_t count;
+    WarmStartEntry entries[WARM_START_MAX_ENTRIES];
+    uint16_t crc;
+
+    uint16_t computeCrc() const
+    {
+        return crc16Ccitt(this, offsetof(WarmStartCache, crc));
+    }
+
+    bool isValid() const
+    {
+        return magic == MAGIC && count <= WARM_START_MAX_ENTRIES && crc == computeCrc();
+    }
+
+    bool hasStaleSamples() const
+    {
+        return count > 0 && sampleGeneration != generation;
+    }
+
+    void clear()
+    {
+        magic = MAGIC;
+        generation = 0;
+        sampleGeneration = 0;
+        count = 0;
+        for (uint8_t i = 0; i < WARM_START_MAX_ENTRIES; ++i)
+        {
+            entries[i] = WarmStartEntry();
+        }
+        seal();
+    }
+
+    void seal()
+    {
+        crc = computeCrc();
+    }
+
+    const WarmStartEntry *find(uint64_t rom) const
+    {
+        for (uint8_t i = 0; i < count; ++i)
+        {
+            if (entries[i].rom == rom)
+                return &entries[i];
+        }
+        return nullptr;
+    }
+};
+
+#pragma pack(pop)
@@ -0,0 +1,53 @@
+#include <cstddef>
+#include "AllocationCounter.h"
+
+uint32_t AllocationCounter::cycleStartCount = 0;
+uint32_t AllocationCounter::steadyStateCycles = 0;
+uint32_t AllocationCounter::steadyStateCount = 0;
+
+#if ALLOC_COUNTER_ENABLED
+
+namespace
+{
+volatile uint32_t g_allocationCount = 0;
+}
+
+// 링커가 원래 함수를 __real_*로, 모든 호출을 __wrap_*로 연결 (-Wl,--wrap=malloc 등)
+extern "C"
+{
+    void *__real_malloc(size_t size);
+    void *__real_calloc(size_t count, size_t size);
+    void *__real_realloc(void *ptr, size_t size);
+
+    void *__wrap_malloc(size_t size)
+    {
+        ++g_allocationCount;
+        return __real_malloc(size);
+    }
+
+    void *__wrap_calloc(size_t count, size_t size)
+    {
+        ++g_allocationCount;
+        return __real_calloc(count, size);
+    }
+
+    void *__wrap_realloc(void *ptr, size_t size)
+    {
+        ++g_allocationCount;
+        return __real_realloc(ptr, size);
+    }
+}
+
+uint32_t AllocationCounter::getCount()
+{
+    return g_allocationCount;
+}
+
+#else
+
+uint32_t AllocationCounter::getCount()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+
+// 1로 빌드하면 malloc/calloc/realloc 호출 횟수를 센다 (링커 --wrap 옵션 필요, README 참고)
+#ifndef ALLOC_COUNTER_ENABLED
+#define ALLOC_COUNTER_ENABLED 0
+#endif
+
+/**
+ * @brief 힙 할당 횟수 계측 (시험 빌드용)
+ *
+ * -Wl,--wrap=malloc 등으로 링크하면 libc/libstdc++ 내부 호출(operator new, String 포함)까지
+ * __wrap_* 함수를 거치므로 펌웨어 전체의 할당 횟수를 셀 수 있다.
+ * 꺼진 빌드에서는 항상 0을 반환하고 래퍼 함수도 만들지 않는다.
+ *
+ * loop()는 부팅 출력이 끝난 뒤(정상 동작 구간) 매 회 beginCycle()/endCycle()로 감싸고,
+ * 그 사이 할당이 있었던 회수를 getSteadyStateCycles()로 확인한다 ('mem' 명령).
+ */
+class AllocationCounter
+{
+public:
+    static constexpr bool ENABLED = ALLOC_COUNTER_ENABLED;
+
+    static uint32_t getCount();
+
+    static void beginCycle() { cycleStartCount = getCount(); }
+    static void endCycle()
+    {
+        uint32_t allocations = getCount() - cycleStartCount;
+        if (allocations > 0)
+        {
+            ++steadyStateCycles;
+            steadyStateCount += allocations;
+        }
+    }
+
+    // 정상 동작 구간에서 할당이 생긴 loop() 회수와 그 할당 횟수 합계 (목표: 0)
+    static uint32_t getSteadyStateCycles() { return steadyStateCycles; }
+    static uint32_t getSteadyStateCount() { return steadyStateCount; }
+
+private:
+    static uint32_t cycleStartCount;
+    static uint32_t steadyStateCycles;
+    static uint32_t steadyStateCount;
+};
@@ -0,0 +1,108 @@
+#include <cstring>
+#include "BinaryLogger.h"
+
+BinaryLogger::BinaryLogger(ILogger *textLogger)
+    : textLogger(textLogger), ring(), recorded(0), oldest(0)
+{
+}
+
+void BinaryLogger::log(LogLevel level, const char *message)
+{
+    if (textLogger)
+        textLogger->log(level, message);
+}
+
+void BinaryLogger::debug(const char *message)
+{
+    log(DEBUG, message);
+}
+
+void BinaryLogger::info(const char *message)
+{
+    log(INFO, message);
+}
+
+void BinaryLogger::warning(const char *message)
+{
+    log(WARNING, message);
+}
+
+void BinaryLogger::error(const char *message)
+{
+    log(ERROR, message);
+}
+
+void BinaryLogger::setLogLevel(LogLevel level)
+{
+    if (textLogger)
+        textLogger->setLogLevel(level);
+}
+
+bool BinaryLogger::isEnabled(LogLevel level) const
+{
+    return textLogger && textLogger->isEnabled(level);
+}
+
+void BinaryLogger::trace(uint16_t id, const int32_t *args, uint8_t count)
+{
+    // 포맷 없이 고정 크기 레코드 복사만 수행 (가득 차면 가장 오래된 레코드 위에 기록)
+    Telemetry::LogRecord &record = ring[recorded & (RING_SIZE - 1)];
+    record.timestampMs = millis();
+    record.id = id;
+    record.argCount = count;
+    memcpy(record.args, args, count * sizeof(int32_t));
+    ++recorded;
+}
+
+void BinaryLogger::clear()
+{
+    oldest = recorded;
+}
+
+uint16_t BinaryLogger::getStoredCount() const
+{
+    uint32_t total = recorded - oldest;
+    return total < RING_SIZE ? static_cast<uint16_t>(total) : RING_SIZE;
+}
+
+uint32_t BinaryLogger::getOverwrittenCount() const
+{
+    uint32_t total = recorded - oldest;
+    return total > RING_SIZE ? total - RING_SIZE : 0;
+}
+
+uint16_t BinaryLogger::dump(Print &out) const
+{
+    static uint8_t payload[Telemetry::MAX_PAYLOAD_SIZE];
+    static uint8_t frame[Telemetry::MAX_FRAME_SIZE];
+
+    uint16_t stored = getStoredCount();
+    uint32_t first = recorded - stored;
+    uint16_t sent = 0;
+
+    while (sent < stored)
+    {
+        uint16_t remaining = stored - sent;
+        uint8_t count = remaining < Telemetry::LOG_RECORDS_PER_FRAME ? remaining : Telemetry::LOG_RECORDS_PER_FRAME;
+
+        // 순번 필드에 첫 레코드 번호를 담아 수신 측에서 덮어쓰기/누락을 검출
+        Telemetry::Header header;
+        header.version = Telemetry::PROTOCOL_VERSION;
+        header.type = Telemetry::FRAME_LOG;
+        header.sequence = static_cast<uint16_t>(first + sent);
+        header.timestampMs = millis();
+        header.count = count;
+
+        memcpy(payload, &header, sizeof(header));
+        for (uint8_t i = 0; i < count; ++i)
+        {
+            const Telemetry::LogRecord &record = ring[(first + sent + i) & (RING_SIZE - 1)];
+            memcpy(payload + sizeof(header) + i * sizeof(record), &record, sizeof(record));
+        }
+
+        size_t length = Telemetry::encodeFrame(payload, sizeof(header) + count * sizeof(Telemetry::LogRecord), frame);
+        out.write(frame, length);
+        sent += count;
+    }
+    return sent;
+}
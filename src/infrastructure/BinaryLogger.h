@@ -0,0 +1,52 @@
+#pragma once
+#include <Arduino.h>
+#include "../domain/ILogger.h"
+#include "../domain/TelemetryProtocol.h"
+
+// 추적 로그 링 크기 (레코드 수, 2의 거듭제곱)
+#ifndef TRACE_RING_SIZE
+#define TRACE_RING_SIZE 32
+#endif
+
+/**
+ * @brief 바이너리 추적 로그 구현체
+ *
+ * LOG_TRACE 호출은 문자열을 만들지 않고 메시지 ID, 시각(ms), 정수 인자만
+ * RAM 링에 복사한다 (가득 차면 가장 오래된 레코드를 덮어씀).
+ * 링은 dump()로 FRAME_LOG 텔레메트리 프레임에 담아 내보내고 호스트 디코더가 문장으로 복원한다.
+ * 텍스트 로그(LOG_DEBUG 등)는 생성 시 받은 로거로 그대로 전달한다.
+ *
+ * loop() 문맥에서만 호출한다 (인터럽트에서 기록하지 않음).
+ */
+class BinaryLogger : public ILogger
+{
+public:
+    static constexpr uint16_t RING_SIZE = TRACE_RING_SIZE;
+    static_assert(RING_SIZE > 0 && (RING_SIZE & (RING_SIZE - 1)) == 0, "TRACE_RING_SIZE must be a power of two");
+
+    explicit BinaryLogger(ILogger *textLogger);
+    ~BinaryLogger() = default;
+
+    void log(LogLevel level, const char *message) override;
+    void debug(const char *message) override;
+    void info(const char *message) override;
+    void warning(const char *message) override;
+    void error(const char *message) override;
+    void setLogLevel(LogLevel level) override;
+    bool isEnabled(LogLevel level) const override;
+    void trace(uint16_t id, const int32_t *args, uint8_t count) override;
+
+    void clear();
+    // 보관 중인 레코드를 오래된 순서로 FRAME_LOG 프레임에 담아 출력, 보낸 레코드 수 반환
+    uint16_t dump(Print &out) const;
+
+    uint32_t getRecordedCount() const { return recorded; }
+    uint16_t getStoredCount() const;
+    uint32_t getOverwrittenCount() const;
+
+private:
+    ILogger *textLogger;
+    Telemetry::LogRecord ring[RING_SIZE];
+    uint32_t recorded; // 지금까지 기록한 레코드 수 (다음 기록 위치 = recorded % RING_SIZE)
+    uint32_t oldest;   // clear() 이후 첫 레코드 번호
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * @brief Cortex-M4 DWT 사이클 카운터 (코드 구간 성능 측정용)
+ *
+ * DWT가 없는 환경에서는 micros() 기반 추정값을 반환한다.
+ */
+namespace CycleCounter
+{
+#ifndef F_CPU
+constexpr uint32_t CPU_HZ = 48000000UL;
+#else
+constexpr uint32_t CPU_HZ = F_CPU;
+#endif
+
+inline void enable()
+{
+#if defined(DWT) && defined(CoreDebug)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+inline uint32_t now()
+{
+#if defined(DWT) && defined(CoreDebug)
+    return DWT->CYCCNT;
+#else
+    return micros() * (CPU_HZ / 1000000UL);
+#endif
+}
+} // namespace CycleCounter
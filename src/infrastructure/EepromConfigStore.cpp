@@ -0,0 +1,281 @@
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include "EepromConfigStore.h"
+#include "../domain/Crc16.h"
+
+EepromConfigStore::Record EepromConfigStore::scratchRecord;
+
+EepromConfigStore::EepromConfigStore()
+    : sequence(0), activeSlot(-1), transactionDepth(0), pendingCommit(false),
+      writeInFlight(false), writeQueued(false), writeSlot(0), writeOffset(0),
+      writeRetries(0), failedWrites(0)
+{
+    shadow.setDefaults();
+}
+
+IConfigStore::LoadResult EepromConfigStore::load()
+{
+    LoadResult result = DEFAULTS;
+    bool found = false;
+
+    shadow.setDefaults();
+    activeSlot = -1;
+    sequence = 0;
+    transactionDepth = 0;
+    pendingCommit = false;
+    writeInFlight = false;
+    writeQueued = false;
+
+    // 각 슬롯을 한 번의 블록 읽기로 검증하고 가장 최근 레코드를 선택
+    for (int slot = 0; slot < JOURNAL_SLOT_COUNT; ++slot)
+    {
+        if (!readSlot(slot, scratchRecord))
+            continue;
+
+        if (found && !isNewer(scratchRecord.header.sequence, sequence))
+            continue;
+
+        // 이전 버전 레코드는 저장된 길이만큼만 복사 (나머지는 기본값 유지)
+        shadow.setDefaults();
+        memcpy(&shadow, &scratchRecord.payload, scratchRecord.header.payloadSize);
+        sequence = scratchRecord.header.sequence;
+        activeSlot = slot;
+        found = true;
+        result = LOADED;
+        if (scratchRecord.header.version < RECORD_VERSION)
+        {
+            migrateRecord(scratchRecord.header.version);
+            result = UPGRADED;
+        }
+    }
+
+    if (!found)
+    {
+        // 저널이 비어 있으면 고정 주소 레이아웃에서 이전
+        result = migrateLegacyLayout() ? MIGRATED_LEGACY : DEFAULTS;
+    }
+
+    // 변환/이전된 레코드는 1회성이므로 부팅 중에 바로 기록
+    if (result != LOADED)
+    {
+        queueWrite();
+        flush();
+    }
+    return result;
+}
+
+bool EepromConfigStore::save()
+{
+    if (transactionDepth > 0)
+    {
+        pendingCommit = true;
+        return true;
+    }
+    queueWrite();
+    return true;
+}
+
+void EepromConfigStore::beginTransaction()
+{
+    ++transactionDepth;
+}
+
+bool EepromConfigStore::commit()
+{
+    if (transactionDepth == 0)
+        return false;
+
+    // 가장 바깥 트랜잭션이 끝날 때 한 번만 기록 예약
+    if (--transactionDepth > 0 || !pendingCommit)
+        return false;
+
+    pendingCommit = false;
+    queueWrite();
+    return true;
+}
+
+void EepromConfigStore::update()
+{
+    writeChunk(WRITE_CHUNK_BYTES);
+}
+
+bool EepromConfigStore::flush()
+{
+    uint16_t failedBefore = failedWrites;
+    while (isWritePending())
+    {
+        writeChunk(sizeof(Record) + 1);
+    }
+    return failedWrites == failedBefore;
+}
+
+void EepromConfigStore::queueWrite()
+{
+    // 진행 중인 기록이 있으면 완료 후 최신 섀도우로 한 번 더 기록
+    if (writeInFlight)
+    {
+        writeQueued = true;
+        return;
+    }
+    writeRetries = 0;
+    startWrite();
+}
+
+void EepromConfigStore::startWrite()
+{
+    scratchRecord.header.magic = RECORD_MAGIC;
+    scratchRecord.header.version = RECORD_VERSION;
+    scratchRecord.header.payloadSize = sizeof(SystemConfig);
+    scratchRecord.header.sequence = sequence + 1;
+    scratchRecord.payload = shadow;
+    scratchRecord.header.crc = computeCrc(scratchRecord.header, scratchRecord.payload);
+
+    // 비활성 슬롯에만 기록하므로 중단되어도 활성 슬롯은 손상되지 않음
+    writeSlot = (activeSlot < 0) ? 0 : (activeSlot + 1) % JOURNAL_SLOT_COUNT;
+    writeOffset = 0;
+    writeInFlight = true;
+}
+
+void EepromConfigStore::writeChunk(uint16_t budget)
+{
+    if (!writeInFlight)
+    {
+        if (!writeQueued)
+            return;
+        writeQueued = false;
+        writeRetries = 0;
+        startWrite();
+    }
+
+    // 기록 순서: magic 무효화 → magic 이후 전체 → magic
+    // (부분 기록된 슬롯이 유효한 레코드로 인식되지 않도록 magic을 마지막에 기록)
+    const uint8_t *image = reinterpret_cast<const uint8_t *>(&scratchRecord);
+    const uint16_t magicSize = sizeof(scratchRecord.header.magic);
+    const uint16_t steps = sizeof(Record) + 1;
+    const int base = slotAddress(writeSlot);
+
+    while (budget > 0 && writeOffset < steps)
+    {
+        if (writeOffset == 0)
+        {
+            EEPROM.update(base, 0x00);
+        }
+        else if (writeOffset <= sizeof(Record) - magicSize)
+        {
+            uint16_t pos = writeOffset + magicSize - 1;
+            EEPROM.update(base + pos, image[pos]);
+        }
+        else
+        {
+            uint16_t pos = writeOffset - (sizeof(Record) - magicSize + 1);
+            EEPROM.update(base + pos, image[pos]);
+        }
+        ++writeOffset;
+        --budget;
+    }
+
+    if (writeOffset >= steps)
+        finishWrite();
+}
+
+void EepromConfigStore::finishWrite()
+{
+    uint32_t expectedSequence = sequence + 1;
+    writeInFlight = false;
+
+    if (readSlot(writeSlot, scratchRecord) && scratchRecord.header.sequence == expectedSequence)
+    {
+        sequence = expectedSequence;
+        activeSlot = writeSlot;
+        writeRetries = 0;
+        return;
+    }
+
+    // 검증 실패: 활성 슬롯은 그대로 두고 제한된 횟수만큼 재시도
+    ++failedWrites;
+    if (writeRetries < MAX_WRITE_RETRIES)
+    {
+        ++writeRetries;
+        startWrite();
+    }
+}
+
+int EepromConfigStore::slotAddress(int slot)
+{
+    return JOURNAL_BASE_ADDR + slot * JOURNAL_SLOT_SIZE;
+}
+
+uint16_t EepromConfigStore::computeCrc(const RecordHeader &header, const SystemConfig &payload)
+{
+    uint16_t crc = crc16Ccitt(&header, offsetof(RecordHeader, crc));
+    return crc16Ccitt(&payload, header.payloadSize, crc);
+}
+
+bool EepromConfigStore::isNewer(uint32_t a, uint32_t b)
+{
+    // 시퀀스 번호 랩어라운드 고려
+    return static_cast<int32_t>(a - b) > 0;
+}
+
+bool EepromConfigStore::readSlot(int slot, Record &record) const
+{
+    EEPROM.get(slotAddress(slot), record);
+
+    if (record.header.magic != RECORD_MAGIC)
+        return false;
+
+    // 현재 펌웨어보다 새로운 레코드나 비정상 길이는 거부
+    if (record.header.version == 0 || record.header.version > RECORD_VERSION)
+        return false;
+    if (record.header.payloadSize == 0 || record.header.payloadSize > sizeof(SystemConfig))
+        return false;
+
+    return record.header.crc == computeCrc(record.header, record.payload);
+}
+
+void EepromConfigStore::migrateRecord(uint16_t fromVersion)
+{
+    // v1 → v2: 표시 행 기반 임계값을 다음 센서 검색 때 ROM별 레코드로 이전
+    if (fromVersion < 2)
+        shadow.legacyRowThresholdsPending = 1;
+}
+
+bool EepromConfigStore::migrateLegacyLayout()
+{
+    bool anyValid = false;
+
+    for (uint8_t i = 0; i < CONFIG_SENSOR_SLOTS; ++i)
+    {
+        float upper, lower;
+        int addr = LEGACY_THRESHOLD_BASE_ADDR + i * LEGACY_SIZE_PER_SENSOR;
+        EEPROM.get(addr, upper);
+        EEPROM.get(addr + 4, lower);
+
+        // 이전 버전과 동일한 검증 규칙 (NaN, 범위, 상한 > 하한)
+        if (isnan(upper) || isnan(lower) ||
+            upper < DS18B20_MIN_TEMP || upper > DS18B20_MAX_TEMP ||
+            lower < DS18B20_MIN_TEMP || lower > DS18B20_MAX_TEMP || upper <= lower)
+        {
+            continue;
+        }
+
+        shadow.thresholds[i].upperThreshold = upper;
+        shadow.thresholds[i].lowerThreshold = lower;
+        shadow.thresholds[i].isCustomSet = 1;
+        shadow.legacyRowThresholdsPending = 1;
+        anyValid = true;
+    }
+
+    uint32_t interval;
+    EEPROM.get(LEGACY_INTERVAL_ADDR, interval);
+    if (interval >= MIN_MEASUREMENT_INTERVAL && interval <= MAX_MEASUREMENT_INTERVAL)
+    {
+        shadow.measurementInterval = interval;
+        anyValid = true;
+    }
+
+    return anyValid;
+}
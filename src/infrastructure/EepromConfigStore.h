@@ -0,0 +1,100 @@
+#pragma once
+#include <Arduino.h>
+#include "../domain/IConfigStore.h"
+
+/**
+ * @brief EEPROM 저널 기반 설정 저장소 구현체
+ *
+ * 설정 전체를 CRC로 보호되는 하나의 버전 레코드로 저장한다.
+ * 두 개의 슬롯을 번갈아 기록(더블 버퍼 저널)하므로 쓰기 도중 전원이
+ * 차단되어도 직전의 정상 레코드로 복구된다.
+ *
+ * 기록은 write-behind 방식이다. save()/commit()은 RAM 섀도우의 스냅샷을
+ * 예약만 하고, update()가 호출될 때마다 WRITE_CHUNK_BYTES씩 데이터 플래시에
+ * 기록한다. 기록 중에 들어온 요청은 하나로 합쳐져 완료 직후 최신 섀도우로 기록된다.
+ */
+class EepromConfigStore : public IConfigStore
+{
+public:
+    EepromConfigStore();
+    ~EepromConfigStore() = default;
+
+    LoadResult load() override;
+    bool save() override;
+    void beginTransaction() override;
+    bool commit() override;
+    bool inTransaction() const override { return transactionDepth > 0; }
+    void update() override;
+    bool flush() override;
+    bool isWritePending() const override { return writeInFlight || writeQueued; }
+    SystemConfig &config() override { return shadow; }
+    const SystemConfig &config() const override { return shadow; }
+    uint32_t getSequence() const override { return sequence; }
+
+    int8_t getActiveSlot() const { return activeSlot; }
+    uint16_t getFailedWriteCount() const { return failedWrites; }
+
+private:
+    static constexpr uint32_t RECORD_MAGIC = 0x46435344; // "DSCF"
+    static constexpr uint16_t RECORD_VERSION = 2;
+
+    // 저널 슬롯 배치 (레거시 레이아웃 0~67 영역 이후)
+    static constexpr int JOURNAL_BASE_ADDR = 128;
+    static constexpr int JOURNAL_SLOT_SIZE = 1024;
+    static constexpr int JOURNAL_SLOT_COUNT = 2;
+
+    // write-behind 설정
+    static constexpr uint16_t WRITE_CHUNK_BYTES = 8; // update() 1회당 기록 바이트
+    static constexpr uint8_t MAX_WRITE_RETRIES = 2;  // 검증 실패 시 재시도 횟수
+
+    // 레거시(v0) 고정 주소 레이아웃
+    static constexpr int LEGACY_THRESHOLD_BASE_ADDR = 0;
+    static constexpr int LEGACY_SIZE_PER_SENSOR = 8; // float(4) + float(4)
+    static constexpr int LEGACY_INTERVAL_ADDR = 64;  // unsigned long(4)
+
+#pragma pack(push, 1)
+    struct RecordHeader
+    {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t payloadSize;
+        uint32_t sequence;
+        uint16_t crc; // 헤더(crc 제외) + payload[payloadSize]
+    };
+
+    struct Record
+    {
+        RecordHeader header;
+        SystemConfig payload;
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(Record) <= JOURNAL_SLOT_SIZE, "config record exceeds journal slot");
+
+    static Record scratchRecord; // 슬롯 읽기/쓰기용 작업 버퍼 (스택 사용량 절감)
+
+    SystemConfig shadow;
+    uint32_t sequence;
+    int8_t activeSlot; // -1: 저장된 레코드 없음
+    uint8_t transactionDepth;
+    bool pendingCommit; // 트랜잭션 중 save() 요청 발생 여부
+
+    // write-behind 큐 (진행 중 1개 + 합쳐진 대기 요청 1개)
+    bool writeInFlight;
+    bool writeQueued;
+    int8_t writeSlot;
+    uint16_t writeOffset;
+    uint8_t writeRetries;
+    uint16_t failedWrites;
+
+    static int slotAddress(int slot);
+    static uint16_t computeCrc(const RecordHeader &header, const SystemConfig &payload);
+    static bool isNewer(uint32_t a, uint32_t b);
+    bool readSlot(int slot, Record &record) const;
+    void queueWrite();
+    void startWrite();
+    void writeChunk(uint16_t budget);
+    void finishWrite();
+    bool migrateLegacyLayout();
+    void migrateRecord(uint16_t fromVersion);
+};
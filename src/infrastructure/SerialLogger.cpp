@@ -1,19 +1,45 @@
 #include "SerialLogger.h"
 
-SerialLogger::SerialLogger() : currentLogLevel(INFO)
+CrashLogRing SerialLogger::crashLog __attribute__((section(".noinit")));
+uint16_t SerialLogger::previousSessionLines = 0;
+
+SerialLogger::SerialLogger(Print &out)
+    : output(out), currentLogLevel(static_cast<LogLevel>(LOG_LEVEL < LOG_LEVEL_NONE ? LOG_LEVEL : LOG_LEVEL_ERROR))
 {
 }
 
 void SerialLogger::log(LogLevel level, const char *message)
 {
-    if (level < currentLogLevel)
+    if (!isEnabled(level))
         return;
 
-    printTimestamp();
-    Serial.print("[");
-    Serial.print(getLevelString(level));
-    Serial.print("] ");
-    Serial.println(message);
+    // 송신 큐에서 한 줄이 한 번에 나가도록 조립 후 기록 (보존 링에 먼저 남김)
+    LineBuffer line;
+    line.appendUInt(millis())
+        .append("ms [")
+        .append(getLevelString(level))
+        .append("] ")
+        .append(message);
+    crashLog.append(line.c_str(), line.length());
+    line.appendLineEnd();
+    output.write(line.data(), line.length());
+}
+
+void SerialLogger::beginCrashLog()
+{
+    crashLog.beginSession();
+
+    previousSessionLines = 0;
+    crashLog.forEachRecord([](bool previousSession, const char *, size_t) {
+        if (previousSession)
+            ++previousSessionLines;
+    });
+}
+
+void SerialLogger::clearCrashLog()
+{
+    crashLog.discardAll();
+    previousSessionLines = 0;
 }
 
 void SerialLogger::debug(const char *message)
@@ -57,9 +83,3 @@ const char *SerialLogger::getLevelString(LogLevel level) const
         return "UNKNOWN";
     }
 }
-
-void SerialLogger::printTimestamp() const
-{
-    Serial.print(millis());
-    Serial.print("ms ");
-}
@@ -1,19 +1,25 @@
 #pragma once
 #include <Arduino.h>
+#include "../domain/CrashLogRing.h"
 #include "../domain/ILogger.h"
 
 /**
  * @brief 시리얼 로거 구현체
  *
- * Arduino Serial을 통한 로깅을 수행하는 구체적 구현
+ * 지정한 Print(기본: 송신 큐)로 "시간ms [레벨] 메시지" 한 줄을 출력하는 구현.
+ * 런타임 레벨의 초기값은 컴파일 하한(LOG_LEVEL)과 같다.
+ *
+ * 출력한 줄은 .noinit RAM의 보존 로그 링에도 기록되어 리셋 후 'crashlog' 명령으로 볼 수 있다
+ * (터미널이 연결되지 않았거나 송신 전에 멈춘 경우 대비).
  */
 class SerialLogger : public ILogger
 {
 private:
+    Print &output;
     LogLevel currentLogLevel;
 
 public:
-    SerialLogger();
+    explicit SerialLogger(Print &out);
     ~SerialLogger() = default;
 
     void log(LogLevel level, const char *message) override;
@@ -22,8 +28,17 @@ public:
     void warning(const char *message) override;
     void error(const char *message) override;
     void setLogLevel(LogLevel level) override;
+    bool isEnabled(LogLevel level) const override { return level >= currentLogLevel; }
+
+    // 부팅 시 로그를 남기기 전에 1회 호출: 이전 세션 레코드 유지, 전원 인가 직후면 비움
+    static void beginCrashLog();
+    static const CrashLogRing &getCrashLog() { return crashLog; }
+    static uint16_t getPreviousSessionLines() { return previousSessionLines; }
+    static void clearCrashLog();
 
 private:
+    static CrashLogRing crashLog;         // 리셋 시 초기화되지 않는 RAM 영역
+    static uint16_t previousSessionLines; // 부팅 시점에 남아 있던 이전 세션 줄 수
+
     const char *getLevelString(LogLevel level) const;
-    void printTimestamp() const;
 };
@@ -0,0 +1,96 @@
+#include "SerialRxQueue.h"
+
+SerialRxQueue::SerialRxQueue(Stream &input)
+    : source(input), ringHead(0), ringTail(0), lineHead(0), lineCount(0), partialLength(0), discarding(false),
+      stats{}
+{
+}
+
+void SerialRxQueue::poll()
+{
+    fillRing();
+    assembleLines();
+}
+
+void SerialRxQueue::fillRing()
+{
+    // 코어 수신 버퍼에 있는 만큼 한 번에 옮김 (링이 차면 나머지는 다음 poll()까지 코어에 남김)
+    int available = source.available();
+    if (available <= 0)
+        return;
+
+    uint16_t space = RING_SIZE - getPendingBytes();
+    if (static_cast<unsigned>(available) > space)
+    {
+        ++stats.stalledPolls;
+        available = space;
+    }
+
+    for (int i = 0; i < available; ++i)
+    {
+        int value = source.read();
+        if (value < 0)
+            break;
+        ring[ringHead++ & (RING_SIZE - 1)] = static_cast<uint8_t>(value);
+        ++stats.receivedBytes;
+    }
+
+    uint16_t pending = getPendingBytes();
+    if (pending > stats.ringHighWater)
+        stats.ringHighWater = pending;
+}
+
+void SerialRxQueue::assembleLines()
+{
+    // 빈 줄 슬롯이 있을 때만 링에서 꺼냄 (슬롯이 차면 입력은 링에 남음)
+    while (ringTail != ringHead && lineCount < LINE_SLOTS)
+    {
+        char c = static_cast<char>(ring[ringTail++ & (RING_SIZE - 1)]);
+        if (c == '\n' || c == '\r')
+        {
+            if (discarding)
+                commitLine(true);
+            else if (partialLength > 0)
+                commitLine(false);
+            discarding = false;
+        }
+        else if (discarding || c < ' ' || c > '~')
+        {
+            continue;
+        }
+        else if (partialLength < LINE_CAPACITY)
+        {
+            lines[(lineHead + lineCount) % LINE_SLOTS].text[partialLength++] = c;
+        }
+        else
+        {
+            // 길이 초과: 줄 끝까지 버린 뒤 overlong 줄 하나로 알림
+            partialLength = 0;
+            discarding = true;
+        }
+    }
+}
+
+void SerialRxQueue::commitLine(bool overlong)
+{
+    Line &line = lines[(lineHead + lineCount) % LINE_SLOTS];
+    line.length = partialLength;
+    line.text[partialLength] = '\0';
+    line.overlong = overlong;
+    partialLength = 0;
+
+    ++lineCount;
+    ++stats.lines;
+    if (overlong)
+        ++stats.overlongLines;
+    if (lineCount > stats.lineHighWater)
+        stats.lineHighWater = lineCount;
+}
+
+void SerialRxQueue::pop()
+{
+    if (lineCount == 0)
+        return;
+    lineHead = (lineHead + 1) % LINE_SLOTS;
+    --lineCount;
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <Arduino.h>
+
+// 수신 바이트 링 크기 (2의 거듭제곱, 줄 큐가 가득 찼을 때 아직 줄로 만들지 않은 입력을 보관)
+#ifndef SERIAL_RX_RING_SIZE
+#define SERIAL_RX_RING_SIZE 512
+#endif
+
+// 처리 대기 줄 개수 (붙여넣기/스크립트 입력을 한 loop()에 여러 줄 받아 두는 깊이)
+#ifndef SERIAL_RX_LINE_SLOTS
+#define SERIAL_RX_LINE_SLOTS 8
+#endif
+
+/**
+ * @brief 줄 단위 시리얼 수신 큐
+ *
+ * poll()은 loop()마다 대상 스트림에 도착한 바이트를 모두 링으로 옮기고, 링에서 완성된 줄을
+ * 고정 크기 줄 슬롯에 넣는다. 소비자는 front()/pop()으로 도착 순서대로 한 줄씩 처리한다.
+ *
+ * 역압: 줄 슬롯이 모두 차면 링에서 더 꺼내지 않고, 링이 차면 스트림에서 더 읽지 않는다.
+ * 그동안 입력은 코어의 수신 버퍼에 남으므로 처리가 따라잡는 동안 줄을 잃지 않는다.
+ * 주기 측정은 변환을 기다리지 않으므로 poll()은 loop()마다 불린다. 메뉴가 표를 바로 다시 그리며
+ * 변환을 기다리는 동안(최대 750 ms)만 코어 수신 버퍼 크기를 넘는 입력을 잃을 수 있다.
+ * 인쇄 가능한 ASCII만 모으고 빈 줄은 버린다. LINE_CAPACITY를 넘는 줄은 내용 없이
+ * overlong 표시만 한 줄로 넣어 소비자가 순서대로 오류를 알린다.
+ */
+class SerialRxQueue
+{
+public:
+    static constexpr uint16_t RING_SIZE = SERIAL_RX_RING_SIZE;
+    static constexpr uint8_t LINE_SLOTS = SERIAL_RX_LINE_SLOTS;
+    static constexpr uint8_t LINE_CAPACITY = 127; // 줄 끝 '\0' 제외 (";" 묶음 한 줄 기준)
+    static_assert(RING_SIZE >= 64 && RING_SIZE <= 32768 && (RING_SIZE & (RING_SIZE - 1)) == 0, "SERIAL_RX_RING_SIZE must be a power of two");
+    static_assert(LINE_SLOTS >= 1, "SERIAL_RX_LINE_SLOTS must be at least 1");
+
+    struct Line
+    {
+        char text[LINE_CAPACITY + 1];
+        uint8_t length;
+        bool overlong; // 길이 초과로 버린 줄 (text는 빈 문자열)
+    };
+
+    struct Stats
+    {
+        uint32_t receivedBytes;
+        uint32_t lines;
+        uint32_t overlongLines;
+        uint32_t stalledPolls;  // 링이 가득 차 스트림 읽기를 멈춘 poll() 횟수
+        uint16_t ringHighWater; // 링 최대 대기 바이트
+        uint8_t lineHighWater;  // 최대 대기 줄
+    };
+
+    explicit SerialRxQueue(Stream &input);
+    ~SerialRxQueue() = default;
+
+    void poll(); // loop()에서 호출, 도착한 입력을 모두 링/줄 슬롯으로 옮김
+
+    bool hasLine() const { return lineCount != 0; }
+    const Line &front() const { return lines[lineHead]; } // hasLine()일 때만
+    void pop();
+
+    uint8_t getPendingLines() const { return lineCount; }
+    uint16_t getPendingBytes() const { return static_cast<uint16_t>(ringHead - ringTail); }
+    const Stats &getStats() const { return stats; }
+
+private:
+    Stream &source;
+    uint8_t ring[RING_SIZE];
+    uint16_t ringHead; // 누적 기록 위치 (RING_SIZE로 나눈 나머지가 실제 위치)
+    uint16_t ringTail;
+    Line lines[LINE_SLOTS];
+    uint8_t lineHead;
+    uint8_t lineCount;
+    uint8_t partialLength; // 다음 빈 슬롯에 만드는 중인 줄의 길이
+    bool discarding;       // 길이 초과 줄의 나머지를 줄 끝까지 버리는 중
+    Stats stats;
+
+    void fillRing();
+    void assembleLines();
+    void commitLine(bool overlong);
+};
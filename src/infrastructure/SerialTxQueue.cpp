@@ -0,0 +1,197 @@
+#include <cstring>
+#include "SerialTxQueue.h"
+
+SerialTxQueue::SerialTxQueue(Print &output, OverflowPolicy overflowPolicy)
+    : target(output),
+      policy(overflowPolicy),
+      bulk{bulkBuffer, BULK_BUFFER_SIZE, 0, 0, 0, '\n', false, {}},
+      urgent{priorityBuffer, PRIORITY_BUFFER_SIZE, 0, 0, 0, '\n', false, {}},
+      priorityWriter(*this, urgent),
+      bulkAtLineStart(true)
+{
+}
+
+size_t SerialTxQueue::write(uint8_t value)
+{
+    return enqueue(bulk, &value, 1);
+}
+
+size_t SerialTxQueue::write(const uint8_t *data, size_t size)
+{
+    return enqueue(bulk, data, size);
+}
+
+int SerialTxQueue::availableForWrite()
+{
+    return bulk.size - bulk.count;
+}
+
+void SerialTxQueue::flush()
+{
+    drainAll();
+    target.flush();
+}
+
+size_t SerialTxQueue::enqueue(Lane &lane, const uint8_t *data, size_t size)
+{
+    // print("")/println("")의 빈 쓰기: 마지막 바이트가 없으므로 줄 상태를 건드리지 않음
+    if (size == 0)
+        return 0;
+
+    if (lane.truncating)
+    {
+        // 잘린 줄의 나머지는 줄바꿈까지 버림
+        const uint8_t *lineEnd = static_cast<const uint8_t *>(memchr(data, '\n', size));
+        size_t skip = lineEnd ? static_cast<size_t>(lineEnd - data) + 1 : size;
+        lane.stats.droppedNewBytes += skip;
+        if (!lineEnd)
+            return 0;
+        lane.truncating = false;
+        data += skip;
+        size -= skip;
+        if (size == 0)
+            return 0;
+    }
+
+    // 줄이 열린 채로 끝나는 출력은 나중에 잘릴 때 끝맺을 줄바꿈 자리까지 함께 확보
+    // (rejectNew()의 줄바꿈을 포함해도 count <= size 유지)
+    size_t reserve = (data[size - 1] != '\n') ? LINE_END_RESERVE : 0;
+    size_t space = freeSpace(lane);
+    if (policy == OverflowPolicy::DropNew)
+    {
+        if (size + reserve > space)
+        {
+            rejectNew(lane, data, size);
+            return 0;
+        }
+    }
+    else
+    {
+        size_t usable = lane.size - reserve;
+        if (size > usable)
+        {
+            // 레인보다 큰 출력은 뒷부분만 보존
+            lane.stats.droppedOldBytes += size - usable;
+            data += size - usable;
+            size = usable;
+        }
+        if (size + reserve > space)
+            dropOldestLine(lane, static_cast<uint16_t>(size + reserve - space));
+    }
+
+    push(lane, data, static_cast<uint16_t>(size));
+    return size;
+}
+
+void SerialTxQueue::push(Lane &lane, const uint8_t *data, uint16_t size)
+{
+    for (uint16_t i = 0; i < size; ++i)
+    {
+        lane.buffer[lane.head] = data[i];
+        lane.head = (lane.head + 1) % lane.size;
+    }
+    lane.count += size;
+    lane.lastByte = data[size - 1];
+    lane.stats.queuedBytes += size;
+    if (lane.count > lane.stats.highWater)
+        lane.stats.highWater = lane.count;
+}
+
+void SerialTxQueue::rejectNew(Lane &lane, const uint8_t *data, size_t size)
+{
+    lane.stats.droppedNewBytes += size;
+
+    // 이미 넣은 줄 앞부분은 예약 공간의 줄바꿈으로 끝맺고 나머지 줄은 버림
+    if (lane.lastByte != '\n')
+    {
+        static const uint8_t LINE_END[LINE_END_RESERVE] = {'\r', '\n'};
+        push(lane, LINE_END, LINE_END_RESERVE);
+    }
+    lane.truncating = (data[size - 1] != '\n');
+}
+
+void SerialTxQueue::dropOldestLine(Lane &lane, uint16_t needed)
+{
+    // 필요한 만큼 버린 뒤 줄 끝까지 마저 버려 다음 전송이 줄 시작에서 이어지도록 함
+    uint16_t dropped = 0;
+    while (lane.count > 0)
+    {
+        uint8_t value = lane.buffer[lane.tail];
+        lane.tail = (lane.tail + 1) % lane.size;
+        --lane.count;
+        ++dropped;
+        if (dropped >= needed && value == '\n')
+            break;
+    }
+    lane.stats.droppedOldBytes += dropped;
+    if (&lane == &bulk)
+        bulkAtLineStart = true;
+}
+
+void SerialTxQueue::drain()
+{
+    // 일부 코어는 availableForWrite()를 구현하지 않고 0을 반환
+    int room = target.availableForWrite();
+    drainBytes(room > 0 ? static_cast<uint16_t>(room) : DRAIN_CHUNK_BYTES);
+}
+
+void SerialTxQueue::drainAll()
+{
+    while (!isEmpty())
+    {
+        uint16_t before = getPendingBytes();
+        drainBytes(before);
+        if (getPendingBytes() == before)
+            return; // 대상 스트림이 더 받지 않음
+    }
+}
+
+void SerialTxQueue::drainBytes(uint16_t budget)
+{
+    while (budget > 0 && !isEmpty())
+    {
+        uint16_t sent;
+        if (urgent.count > 0 && bulkAtLineStart)
+            sent = sendFrom(urgent, budget, false);
+        else
+            sent = sendFrom(bulk, budget, urgent.count > 0);
+
+        if (sent == 0)
+            return;
+        budget -= sent;
+    }
+}
+
+uint16_t SerialTxQueue::sendFrom(Lane &lane, uint16_t budget, bool stopAtLineEnd)
+{
+    // 링 버퍼 끝까지 연속 구간 단위로 한 번에 전송
+    uint16_t run = (lane.tail < lane.head) ? lane.head - lane.tail : lane.size - lane.tail;
+    if (run > lane.count)
+        run = lane.count;
+    if (run > budget)
+        run = budget;
+
+    // 우선순위 줄이 대기 중이면 현재 줄 끝까지만 전송
+    if (stopAtLineEnd)
+    {
+        for (uint16_t i = 0; i < run; ++i)
+        {
+            if (lane.buffer[lane.tail + i] == '\n')
+            {
+                run = i + 1;
+                break;
+            }
+        }
+    }
+
+    size_t sent = target.write(lane.buffer + lane.tail, run);
+    if (sent == 0)
+        return 0;
+
+    if (&lane == &bulk)
+        bulkAtLineStart = (lane.buffer[lane.tail + sent - 1] == '\n');
+    lane.tail = (lane.tail + sent) % lane.size;
+    lane.count -= sent;
+    lane.stats.sentBytes += sent;
+    return static_cast<uint16_t>(sent);
+}
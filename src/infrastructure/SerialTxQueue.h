@@ -0,0 +1,103 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * @brief 비차단 시리얼 송신 큐 (Print 구현체)
+ *
+ * print() 호출은 고정 크기 링 버퍼에 쌓기만 하고 즉시 반환한다.
+ * 실제 전송은 loop()마다 drain()이 대상 스트림의 송신 여유(availableForWrite())만큼
+ * 나누어 수행하므로 큰 표/메뉴 출력이 UART 송신 버퍼를 기다리며 loop()를 멈추지 않는다.
+ *
+ * 우선순위 레인(priority())에 쓴 줄은 일반 출력보다 먼저 전송된다.
+ * 일반 출력이 한 줄을 보내는 중이면 그 줄이 끝난 뒤 끼워 넣어 줄이 섞이지 않는다.
+ * 버퍼가 가득 차면 정책에 따라 새 데이터를 버리거나(DropNew) 가장 오래된 줄을
+ * 버리고(DropOldest) 버린 바이트 수를 레인별로 기록한다.
+ */
+class SerialTxQueue : public Print
+{
+public:
+    enum class OverflowPolicy : uint8_t
+    {
+        DropNew,   // 큐에 들어간 출력 보존, 넘치는 새 데이터 버림
+        DropOldest // 최신 출력 보존, 가장 오래된 줄부터 버림
+    };
+
+    struct LaneStats
+    {
+        uint32_t queuedBytes;
+        uint32_t sentBytes;
+        uint32_t droppedNewBytes;
+        uint32_t droppedOldBytes;
+        uint16_t highWater; // 최대 대기 바이트
+    };
+
+    explicit SerialTxQueue(Print &output, OverflowPolicy policy = OverflowPolicy::DropNew);
+    ~SerialTxQueue() = default;
+
+    // 일반 레인 (Print 인터페이스)
+    size_t write(uint8_t value) override;
+    size_t write(const uint8_t *data, size_t size) override;
+    int availableForWrite() override;
+    void flush() override; // 큐 전체 전송 후 대상 스트림 flush (블로킹)
+    using Print::write;
+
+    Print &priority() { return priorityWriter; } // 우선순위 레인 (경보 등)
+
+    void drain();    // loop()에서 호출, 송신 가능한 만큼만 전송
+    void drainAll(); // 큐를 모두 전송 (블로킹)
+    bool isEmpty() const { return bulk.count == 0 && urgent.count == 0; }
+    uint16_t getPendingBytes() const { return bulk.count + urgent.count; }
+
+    OverflowPolicy getOverflowPolicy() const { return policy; }
+    void setOverflowPolicy(OverflowPolicy newPolicy) { policy = newPolicy; }
+    const LaneStats &getBulkStats() const { return bulk.stats; }
+    const LaneStats &getPriorityStats() const { return urgent.stats; }
+
+private:
+    static constexpr uint16_t BULK_BUFFER_SIZE = 4096;
+    static constexpr uint16_t PRIORITY_BUFFER_SIZE = 256;
+    static constexpr uint16_t DRAIN_CHUNK_BYTES = 64; // availableForWrite() 미지원 코어용
+    static constexpr uint16_t LINE_END_RESERVE = 2;   // 잘린 줄을 끝맺을 "\r\n" 자리
+
+    struct Lane
+    {
+        uint8_t *buffer;
+        uint16_t size;
+        uint16_t head; // 다음 쓰기 위치
+        uint16_t tail; // 다음 전송 위치
+        uint16_t count;
+        uint8_t lastByte;  // 마지막으로 넣은 바이트 (줄 중간 여부 판단)
+        bool truncating;   // 넘침으로 잘린 줄의 나머지를 버리는 중
+        LaneStats stats;
+    };
+
+    class LaneWriter : public Print
+    {
+    public:
+        LaneWriter(SerialTxQueue &owner, Lane &lane) : owner(owner), lane(lane) {}
+        size_t write(uint8_t value) override { return owner.enqueue(lane, &value, 1); }
+        size_t write(const uint8_t *data, size_t size) override { return owner.enqueue(lane, data, size); }
+        using Print::write;
+
+    private:
+        SerialTxQueue &owner;
+        Lane &lane;
+    };
+
+    Print &target;
+    OverflowPolicy policy;
+    uint8_t bulkBuffer[BULK_BUFFER_SIZE];
+    uint8_t priorityBuffer[PRIORITY_BUFFER_SIZE];
+    Lane bulk;
+    Lane urgent;
+    LaneWriter priorityWriter;
+    bool bulkAtLineStart; // 일반 레인이 줄 경계에 있을 때만 우선순위 줄 삽입
+
+    static size_t freeSpace(const Lane &lane) { return lane.count >= lane.size ? 0 : lane.size - lane.count; }
+    size_t enqueue(Lane &lane, const uint8_t *data, size_t size);
+    void push(Lane &lane, const uint8_t *data, uint16_t size);
+    void rejectNew(Lane &lane, const uint8_t *data, size_t size);
+    void dropOldestLine(Lane &lane, uint16_t needed);
+    uint16_t sendFrom(Lane &lane, uint16_t budget, bool stopAtLineEnd);
+    void drainBytes(uint16_t budget);
+};
@@ -0,0 +1,122 @@
+// 설정 블롭 검사 점검 (호스트용)
+//
+// 빌드: g++ -std=c++17 -O2 -I src tools/bench/config_blob_check.cpp src/domain/ConfigBlob.cpp -o config_blob_check
+// 사용: config_blob_check
+//
+// 설정을 블롭으로 만들어 그대로 검사·적용했을 때 레코드가 같은지 확인한 뒤, 레코드 필드를 하나씩 바꾸고
+// CRC를 다시 계산한 블롭이 validate()에서 기대한 사유로 거부되는지 본다 (CRC가 맞아도 값 검사가 막아야 하는 경우).
+// 하나라도 어긋나면 종료 코드 1을 반환한다.
+#include <cstdio>
+#include <cstring>
+#include "domain/ConfigBlob.h"
+#include "domain/Crc16.h"
+#include "domain/SensorConfigTable.h"
+
+namespace
+{
+int failures = 0;
+
+void makeConfig(SystemConfig &config)
+{
+    config.setDefaults();
+    config.measurementInterval = 300000;
+    const uint64_t roms[] = {0x2811000000000001ULL, 0x2805000000000002ULL, 0x2833000000000003ULL};
+    const uint8_t ids[] = {1, 2, 0};
+    for (uint8_t i = 0; i < 3; ++i)
+    {
+        SensorConfigRecord &record = config.sensorRecords[i];
+        record.setDefaults(roms[i]);
+        record.logicalId = ids[i];
+    }
+    config.sensorRecords[1].isCustomSet = 1;
+    config.sensorRecords[1].upperThreshold = 35.5f;
+    config.sensorRecords[2].resolution = 9;
+    config.sensorRecords[2].calibrationCenti = -25;
+}
+
+uint8_t *recordAt(uint8_t *blob, uint8_t index)
+{
+    return blob + ConfigBlob::HEADER_SIZE + index * ConfigBlob::RECORD_SIZE;
+}
+
+// 바꾼 내용에 맞춰 CRC를 다시 씀 (리틀 엔디언, 블롭 끝 2바이트)
+void resign(uint8_t *blob, size_t length)
+{
+    uint16_t crc = crc16Ccitt(blob, length - ConfigBlob::CRC_SIZE);
+    blob[length - 2] = static_cast<uint8_t>(crc);
+    blob[length - 1] = static_cast<uint8_t>(crc >> 8);
+}
+
+void expect(const char *name, ConfigBlob::Result actual, ConfigBlob::Result expected)
+{
+    printf("%-28s %-8s", name, ConfigBlob::resultName(actual));
+    if (actual != expected)
+    {
+        printf(" FAIL (expected %s)", ConfigBlob::resultName(expected));
+        ++failures;
+    }
+    printf("\n");
+}
+
+struct Mutation
+{
+    const char *name;
+    void (*apply)(uint8_t *blob);
+    ConfigBlob::Result expected;
+};
+
+const Mutation MUTATIONS[] = {
+    {"duplicate logical id", [](uint8_t *blob) { recordAt(blob, 2)[8] = 1; }, ConfigBlob::Result::Value},
+    {"both unassigned (id 0)", [](uint8_t *blob) { recordAt(blob, 1)[8] = 0; }, ConfigBlob::Result::Ok},
+    {"logical id 9", [](uint8_t *blob) { recordAt(blob, 2)[8] = 9; }, ConfigBlob::Result::Value},
+    {"isCustomSet 2", [](uint8_t *blob) { recordAt(blob, 0)[10] = 2; }, ConfigBlob::Result::Value},
+    {"duplicate rom", [](uint8_t *blob) { memcpy(recordAt(blob, 1), recordAt(blob, 0), 8); },
+     ConfigBlob::Result::Value},
+    {"resolution 13", [](uint8_t *blob) { recordAt(blob, 0)[9] = 13; }, ConfigBlob::Result::Value},
+    {"version 2", [](uint8_t *blob) { blob[0] = 2; }, ConfigBlob::Result::Version},
+};
+} // namespace
+
+int main()
+{
+    SystemConfig config;
+    makeConfig(config);
+    uint8_t blob[ConfigBlob::MAX_SIZE];
+    size_t length = ConfigBlob::encode(config, blob);
+    expect("encoded blob", ConfigBlob::validate(blob, length), ConfigBlob::Result::Ok);
+
+    // 왕복: 적용한 레코드가 원본과 같아야 함
+    SystemConfig restored;
+    restored.setDefaults();
+    ConfigBlob::applyTo(blob, restored);
+    if (memcmp(restored.sensorRecords, config.sensorRecords, sizeof(config.sensorRecords)) != 0 ||
+        restored.measurementInterval != config.measurementInterval)
+    {
+        printf("round trip                   FAIL (records differ)\n");
+        ++failures;
+    }
+
+    for (const Mutation &mutation : MUTATIONS)
+    {
+        uint8_t copy[ConfigBlob::MAX_SIZE];
+        memcpy(copy, blob, length);
+        mutation.apply(copy);
+        resign(copy, length);
+        expect(mutation.name, ConfigBlob::validate(copy, length), mutation.expected);
+    }
+
+    // CRC를 다시 쓰지 않은 변경과 잘린 블롭
+    uint8_t copy[ConfigBlob::MAX_SIZE];
+    memcpy(copy, blob, length);
+    recordAt(copy, 0)[8] ^= 0x01;
+    expect("unsigned change", ConfigBlob::validate(copy, length), ConfigBlob::Result::Crc);
+    expect("truncated", ConfigBlob::validate(blob, length - 1), ConfigBlob::Result::Length);
+
+    if (failures)
+    {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
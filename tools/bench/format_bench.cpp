@@ -0,0 +1,206 @@
+// Format 모듈 마이크로 벤치마크 (호스트용)
+//
+// 빌드: g++ -std=c++17 -O2 -I src tools/bench/format_bench.cpp src/domain/Format.cpp -o format_bench
+// 사용: format_bench [반복 횟수]   (기본 1000000)
+//
+// 펌웨어가 쓰던 String 이어 붙이기 / float 출력 경로를 std::string·snprintf로 재현해
+// 같은 입력에 대한 호출당 시간(ns)과 힙 할당 횟수를 Format 함수와 비교한다.
+// 측정 전에 이전 경로와 출력이 같은지 확인하고 (온도는 DS18B20 전 범위),
+// 다르면 종료 코드 1을 반환한다.
+// 호스트 std::string은 짧은 문자열을 힙 없이 담으므로(SSO) 할당 횟수는 Arduino String보다 적게 나온다.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include "domain/Format.h"
+
+namespace
+{
+unsigned long g_allocations = 0;
+volatile size_t g_sink = 0; // 최적화로 루프가 사라지지 않도록 결과 길이를 누적
+
+// ---- 이전 구현 재현 (Arduino String → std::string) ----
+
+// SensorController::formatInterval (String 이어 붙이기)
+std::string legacyInterval(unsigned long intervalMs)
+{
+    std::string result = "";
+    unsigned long totalSeconds = intervalMs / 1000;
+    unsigned long units[4] = {totalSeconds / 86400, totalSeconds % 86400 / 3600,
+                              totalSeconds % 3600 / 60, totalSeconds % 60};
+    static const char *const NAMES[4] = {"일", "시간", "분", "초"};
+
+    if (totalSeconds < 60)
+        return std::to_string(totalSeconds) + "초";
+
+    for (int i = 0; i < 4; ++i)
+    {
+        if (units[i] == 0)
+            continue;
+        if (!result.empty())
+            result += " ";
+        result += std::to_string(units[i]) + NAMES[i];
+    }
+    return result;
+}
+
+// Print::print(float, 1) 경로 (Arduino printFloat: double로 0.05를 더한 뒤 자릿수별 출력)
+// x.x5 경계에서는 이진 오차에 따라 내림/올림이 갈리므로 출력 비교에는 쓰지 않고 시간만 잰다.
+std::string legacyCelsius(double value)
+{
+    std::string result;
+    if (value < 0)
+    {
+        result += "-";
+        value = -value;
+    }
+    value += 0.05;
+    unsigned long whole = static_cast<unsigned long>(value);
+    double remainder = value - static_cast<double>(whole);
+    result += std::to_string(whole);
+    result += ".";
+    result += std::to_string(static_cast<unsigned int>(remainder * 10.0));
+    return result;
+}
+
+// 상태 테이블이 쓰던 float → 0.1 단위 반올림(0에서 먼 쪽) 경로
+std::string legacyTenths(float value)
+{
+    int32_t tenths = static_cast<int32_t>(value >= 0 ? value * 10 + 0.5f : value * 10 - 0.5f);
+    int32_t magnitude = tenths < 0 ? -tenths : tenths;
+    char text[16];
+    snprintf(text, sizeof(text), "%s%d.%d", tenths < 0 ? "-" : "", magnitude / 10, magnitude % 10);
+    return std::string(text);
+}
+
+// Print::print(byte, HEX) 를 8번 호출하던 주소 출력
+std::string legacyRomHex(const uint8_t *addr)
+{
+    std::string result;
+    for (int i = 0; i < 8; ++i)
+    {
+        char text[4];
+        snprintf(text, sizeof(text), "%02X", addr[i]);
+        result += text;
+    }
+    return result;
+}
+
+// ---- 측정 ----
+
+template <typename Fn>
+void bench(const char *name, unsigned long iterations, Fn fn)
+{
+    unsigned long allocationsBefore = g_allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < iterations; ++i)
+    {
+        g_sink += fn(i);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double ns = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    double allocs = static_cast<double>(g_allocations - allocationsBefore) / iterations;
+    printf("%-28s %8.1f ns/call  %5.2f alloc/call\n", name, ns, allocs);
+}
+
+const unsigned long INTERVALS[] = {10000, 60000, 90061000, 3600000, 2592000000UL, 86405000};
+const uint8_t ROMS[][8] = {{0x28, 0xFF, 0x64, 0x1E, 0x0F, 0x00, 0x00, 0x5A},
+                           {0x28, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02}};
+
+bool verify()
+{
+    bool ok = true;
+    char text[Format::INTERVAL_SIZE];
+
+    for (unsigned long ms : INTERVALS)
+    {
+        Format::interval(text, sizeof(text), ms);
+        if (legacyInterval(ms) != text)
+        {
+            printf("interval mismatch: %lu → '%s' / '%s'\n", ms, legacyInterval(ms).c_str(), text);
+            ok = false;
+        }
+    }
+
+    // DS18B20 12비트 전 범위 (1/16°C 단위)
+    for (int32_t raw = -55 * 16; raw <= 125 * 16; ++raw)
+    {
+        Format::temperature(text, sizeof(text), raw, 1);
+        if (legacyTenths(raw / 16.0f) != text)
+        {
+            printf("temperature mismatch: %d → '%s' / '%s'\n", raw, legacyTenths(raw / 16.0f).c_str(), text);
+            ok = false;
+        }
+    }
+
+    for (const uint8_t *rom : ROMS)
+    {
+        Format::romHex(text, sizeof(text), rom);
+        if (legacyRomHex(rom) != text)
+        {
+            printf("rom mismatch: '%s' / '%s'\n", legacyRomHex(rom).c_str(), text);
+            ok = false;
+        }
+    }
+    return ok;
+}
+} // namespace
+
+void *operator new(size_t size)
+{
+    ++g_allocations;
+    void *p = std::malloc(size ? size : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    std::free(p);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long iterations = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+    if (iterations == 0)
+        iterations = 1;
+
+    if (!verify())
+        return 1;
+
+    const size_t intervalCount = sizeof(INTERVALS) / sizeof(INTERVALS[0]);
+    bench("interval / String", iterations, [&](unsigned long i) {
+        return legacyInterval(INTERVALS[i % intervalCount]).size();
+    });
+    bench("interval / Format", iterations, [&](unsigned long i) {
+        char text[Format::INTERVAL_SIZE];
+        return Format::interval(text, sizeof(text), INTERVALS[i % intervalCount]);
+    });
+
+    bench("temperature / printFloat", iterations, [](unsigned long i) {
+        return legacyCelsius(static_cast<int32_t>(i % 2881) / 16.0f - 55.0f).size();
+    });
+    bench("temperature / Format", iterations, [](unsigned long i) {
+        char text[Format::TEMPERATURE_SIZE];
+        return Format::temperature(text, sizeof(text), static_cast<int32_t>(i % 2881) - 55 * 16, 1);
+    });
+
+    bench("rom / per-byte HEX", iterations, [](unsigned long i) {
+        return legacyRomHex(ROMS[i & 1]).size();
+    });
+    bench("rom / Format", iterations, [](unsigned long i) {
+        char text[Format::ROM_HEX_SIZE];
+        return Format::romHex(text, sizeof(text), ROMS[i & 1]);
+    });
+
+    printf("(sink %zu)\n", static_cast<size_t>(g_sink));
+    return 0;
+}
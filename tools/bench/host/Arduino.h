@@ -0,0 +1,28 @@
+// 호스트 점검 도구용 최소 Arduino.h (Print만 제공)
+//
+// infrastructure/의 Print 기반 클래스를 호스트에서 그대로 컴파일하기 위한 대역.
+// 도구 빌드 시 -I tools/bench/host를 -I src보다 먼저 지정한다.
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+class Print
+{
+public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t value) = 0;
+    virtual size_t write(const uint8_t *data, size_t size)
+    {
+        size_t written = 0;
+        while (size-- > 0)
+            written += write(*data++);
+        return written;
+    }
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+
+    size_t write(const char *text) { return write(reinterpret_cast<const uint8_t *>(text), strlen(text)); }
+    size_t print(const char *text) { return write(text); }
+    size_t println(const char *text) { return write(text) + write("\r\n"); }
+};
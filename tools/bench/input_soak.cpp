@@ -0,0 +1,314 @@
+// 메뉴 입력 경로 힙 사용량 소크 테스트 (호스트용)
+//
+// 빌드: g++ -std=c++17 -O2 -I src tools/bench/input_soak.cpp src/domain/TextParse.cpp -o input_soak
+// 사용: input_soak [명령 줄 수]   (기본 5000000)
+//
+// 펌웨어의 입력 경로(한 글자씩 InputLine에 쌓고, 줄이 끝나면 TextParse로 해석)를
+// 명령 줄 목록으로 반복 실행하면서 operator new/delete를 세어 힙 사용량이 변하지 않는지 확인한다.
+// 실행 전에 TextParse 결과가 이전 String 구현(std::string으로 재현)·atol·atof와 같은지 대조하고,
+// 불일치가 있거나 반복 중 할당이 한 번이라도 생기면 종료 코드 1을 반환한다.
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include "domain/FixedString.h"
+#include "domain/SystemConfig.h"
+#include "domain/TextParse.h"
+
+namespace
+{
+unsigned long g_allocations = 0;
+long g_liveBytes = 0;
+volatile long g_sink = 0; // 최적화로 해석 결과가 사라지지 않도록 누적
+
+constexpr size_t INPUT_LINE_CAPACITY = 16; // src/application/InputHandler.h와 같은 값
+using InputLine = FixedString<INPUT_LINE_CAPACITY>;
+
+// ---- 이전 구현 재현 (Arduino String → std::string) ----
+
+// MenuController::parseIntervalInput
+unsigned long legacyParseInterval(const std::string &input)
+{
+    size_t first = 0;
+    size_t last = input.size();
+    while (first < last && isspace(static_cast<unsigned char>(input[first])))
+        ++first;
+    while (last > first && isspace(static_cast<unsigned char>(input[last - 1])))
+        --last;
+    std::string trimmedInput = input.substr(first, last - first);
+    for (char &c : trimmedInput)
+        c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+
+    if (trimmedInput.length() == 0)
+        return 0;
+
+    unsigned long totalMs = 0;
+    std::string currentNumber = "";
+    for (char c : trimmedInput)
+    {
+        if (isdigit(static_cast<unsigned char>(c)))
+        {
+            currentNumber += c;
+        }
+        else if (c == 'd' || c == 'h' || c == 'm' || c == 's')
+        {
+            if (currentNumber.length() == 0)
+                return 0;
+            long number = atol(currentNumber.c_str());
+            if (number <= 0)
+                return 0;
+            unsigned long multiplier = 1000;
+            if (c == 'd')
+                multiplier = 24 * 60 * 60 * 1000;
+            else if (c == 'h')
+                multiplier = 60 * 60 * 1000;
+            else if (c == 'm')
+                multiplier = 60 * 1000;
+            if (number > static_cast<long>(MAX_MEASUREMENT_INTERVAL / multiplier))
+                return 0;
+            unsigned long partMs = static_cast<unsigned long>(number) * multiplier;
+            if (totalMs > MAX_MEASUREMENT_INTERVAL - partMs)
+                return 0;
+            totalMs += partMs;
+            currentNumber = "";
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    if (currentNumber.length() > 0)
+    {
+        long number = atol(currentNumber.c_str());
+        if (number <= 0)
+            return 0;
+        if (number > static_cast<long>(MAX_MEASUREMENT_INTERVAL / 1000))
+            return 0;
+        unsigned long partMs = static_cast<unsigned long>(number) * 1000;
+        if (totalMs > MAX_MEASUREMENT_INTERVAL - partMs)
+            return 0;
+        totalMs += partMs;
+    }
+
+    if (totalMs < MIN_MEASUREMENT_INTERVAL)
+        return 0;
+    return totalMs;
+}
+
+// SensorMenuHandler::parseSensorIndices
+std::string legacySensorIndices(const std::string &input)
+{
+    std::string indices;
+    bool used[9] = {false};
+    for (char c : input)
+    {
+        if (c >= '1' && c <= '8' && !used[c - '0'])
+        {
+            indices += c;
+            used[c - '0'] = true;
+        }
+    }
+    return indices;
+}
+
+// ---- 대조 ----
+
+int g_mismatches = 0;
+
+void check(const std::string &input)
+{
+    unsigned long expected = legacyParseInterval(input);
+    unsigned long actual = TextParse::parseIntervalMs(input);
+    if (expected != actual)
+    {
+        ++g_mismatches;
+        printf("interval 불일치: \"%s\" 이전=%lu 현재=%lu\n", input.c_str(), expected, actual);
+    }
+
+    if (atol(input.c_str()) != TextParse::toLong(input))
+    {
+        ++g_mismatches;
+        printf("toLong 불일치: \"%s\"\n", input.c_str());
+    }
+
+    float expectedFloat = static_cast<float>(atof(input.c_str()));
+    float actualFloat = TextParse::toFloat(input);
+    if (memcmp(&expectedFloat, &actualFloat, sizeof(float)) != 0)
+    {
+        ++g_mismatches;
+        printf("toFloat 불일치: \"%s\"\n", input.c_str());
+    }
+
+    int indices[8];
+    uint8_t count = TextParse::parseSensorIndices(input, indices, 8);
+    std::string actualIndices;
+    for (uint8_t i = 0; i < count; ++i)
+        actualIndices += static_cast<char>('0' + indices[i]);
+    if (legacySensorIndices(input) != actualIndices)
+    {
+        ++g_mismatches;
+        printf("sensor index 불일치: \"%s\"\n", input.c_str());
+    }
+}
+
+// 짧은 입력은 전수, 긴 입력은 무작위로 대조
+void verifyAgainstLegacy()
+{
+    static const char ALPHABET[] = "0123456789dhmsDHMS x,.-+";
+    const size_t letters = sizeof(ALPHABET) - 1;
+
+    std::string input;
+    for (size_t length = 0; length <= 4; ++length)
+    {
+        size_t combinations = 1;
+        for (size_t i = 0; i < length; ++i)
+            combinations *= letters;
+        for (size_t n = 0; n < combinations; ++n)
+        {
+            input.clear();
+            for (size_t i = 0, rest = n; i < length; ++i, rest /= letters)
+                input += ALPHABET[rest % letters];
+            check(input);
+        }
+    }
+
+    unsigned int seed = 12345;
+    for (int n = 0; n < 1000000; ++n)
+    {
+        seed = seed * 1103515245 + 12345;
+        size_t length = 5 + (seed >> 16) % 12;
+        input.clear();
+        for (size_t i = 0; i < length; ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            input += ALPHABET[(seed >> 16) % letters];
+        }
+        check(input);
+    }
+
+    for (const char *edge : {"2592000", "2592001", "30d", "31d", "720h", "721h", "43200m", "10", "9", "9s10",
+                             "99999999999999", "-0", "+5", " 12 ", "2147483648", "-2147483649"})
+    {
+        check(edge);
+    }
+}
+
+// ---- 소크 ----
+
+// InputHandler::isValidMenuChar
+bool isValidMenuChar(char c)
+{
+    return isalnum(static_cast<unsigned char>(c)) || c == ',' || c == '-';
+}
+
+// MenuController가 한 줄을 받았을 때 하는 해석을 흉내냄
+void handleLine(const InputLine &line)
+{
+    std::string_view input = line.view();
+    long value = 0;
+
+    if (line.startsWith("mode") || line.startsWith("baud") || line.startsWith("txq"))
+    {
+        std::string_view arg = TextParse::trim(input.substr(line.startsWith("txq") ? 3 : 4));
+        value += TextParse::equalsIgnoreCase(arg, "csv") + TextParse::equalsIgnoreCase(arg, "oldest");
+        value += TextParse::toLong(arg);
+    }
+    else if (line.startsWith("delta"))
+    {
+        std::string_view arg = TextParse::trim(input.substr(5));
+        if (TextParse::startsWithIgnoreCase(arg, "db") || TextParse::startsWithIgnoreCase(arg, "kf"))
+            value += TextParse::toLong(arg.substr(2));
+    }
+    else
+    {
+        int indices[8];
+        value += TextParse::parseSensorIndices(input, indices, 8);
+        value += static_cast<long>(TextParse::parseIntervalMs(input) / 1000);
+        value += static_cast<long>(TextParse::toFloat(input) * 10);
+        value += TextParse::toLong(input);
+    }
+    g_sink = g_sink + value;
+}
+
+const char *const COMMANDS[] = {
+    "mode", "modecsv", "modeJSON", "baud", "baud921600", "baudok", "delta", "deltadb25", "deltakf10",
+    "txq", "txqoldest", "trace", "crashlog", "m", "1", "2", "3", "c", "y", "n", "1,3,5", "12345678",
+    "25", "-10", "30s", "1h30m", "1d2h30m", "99999", "abc", "0123456789abcdefghij", "x,y-z", "",
+};
+} // namespace
+
+void *operator new(size_t size)
+{
+    ++g_allocations;
+    // 크기를 앞에 붙여 delete에서 살아 있는 바이트 수를 되돌림
+    size_t *block = static_cast<size_t *>(malloc(size + sizeof(size_t)));
+    if (!block)
+        throw std::bad_alloc();
+    *block = size;
+    g_liveBytes += static_cast<long>(size);
+    return block + 1;
+}
+
+void operator delete(void *p) noexcept
+{
+    if (!p)
+        return;
+    size_t *block = static_cast<size_t *>(p) - 1;
+    g_liveBytes -= static_cast<long>(*block);
+    free(block);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    operator delete(p);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long lines = argc > 1 ? strtoul(argv[1], nullptr, 10) : 5000000;
+
+    verifyAgainstLegacy();
+    if (g_mismatches > 0)
+    {
+        printf("이전 구현과 %d건 불일치\n", g_mismatches);
+        return 1;
+    }
+    printf("이전 구현 대조: 일치\n");
+
+    const size_t commandCount = sizeof(COMMANDS) / sizeof(COMMANDS[0]);
+    InputLine line;
+    unsigned long overflows = 0;
+
+    unsigned long allocationsBefore = g_allocations;
+    long liveBefore = g_liveBytes;
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned long n = 0; n < lines; ++n)
+    {
+        // 시리얼에서 한 글자씩 들어오는 것처럼 쌓고 줄 끝에서 해석 (InputHandler와 같은 넘침 처리)
+        const char *command = COMMANDS[n % commandCount];
+        for (const char *p = command; *p; ++p)
+        {
+            if (isValidMenuChar(*p) && !line.append(*p))
+            {
+                ++overflows;
+                line.clear();
+            }
+        }
+        if (!line.isEmpty())
+            handleLine(line);
+        line.clear();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    unsigned long allocations = g_allocations - allocationsBefore;
+    long liveDelta = g_liveBytes - liveBefore;
+
+    printf("명령 %lu줄 (넘침 %lu), %.1f ns/줄, 할당 %lu회, 힙 증감 %ld B\n", lines, overflows,
+           seconds * 1e9 / (lines ? lines : 1), allocations, liveDelta);
+    return (allocations == 0 && liveDelta == 0) ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+// SerialTxQueue 넘침 처리 점검 (호스트용)
+//
+// 빌드: g++ -std=c++17 -O2 -I tools/bench/host -I src tools/bench/tx_queue_check.cpp src/infrastructure/SerialTxQueue.cpp -o tx_queue_check
+// 사용: tx_queue_check
+//
+// 전송이 멈춘 대상에 줄바꿈 없는 출력으로 일반 레인을 가득 채운 뒤, 넘치는 줄을 넣어 거부/버림을 일으키고
+// 다시 출력한다. 매 단계 대기 바이트가 레인 크기를 넘지 않는지, 전송 재개 후 잘린 줄이 줄바꿈으로
+// 끝맺어지고 다음 줄이 온전히 도착하는지, 빈 쓰기가 줄 상태를 바꾸지 않는지 두 넘침 정책 모두 확인한다.
+// 어긋나면 종료 코드 1을 반환한다.
+#include <cstdio>
+#include <string>
+#include "infrastructure/SerialTxQueue.h"
+
+namespace
+{
+constexpr uint16_t BULK_LANE_SIZE = 4096; // SerialTxQueue::BULK_BUFFER_SIZE
+constexpr uint16_t LINE_END_RESERVE = 2;  // SerialTxQueue::LINE_END_RESERVE
+
+// open이 false인 동안 아무것도 받지 않는 대상 스트림
+class StallingTarget : public Print
+{
+public:
+    bool open = false;
+    std::string received;
+
+    size_t write(uint8_t value) override { return write(&value, 1); }
+    size_t write(const uint8_t *data, size_t size) override
+    {
+        if (!open)
+            return 0;
+        received.append(reinterpret_cast<const char *>(data), size);
+        return size;
+    }
+    int availableForWrite() override { return open ? 1024 : 0; }
+};
+
+int failures = 0;
+
+void expect(bool condition, const char *policy, const char *what)
+{
+    if (!condition)
+    {
+        printf("FAIL [%s] %s\n", policy, what);
+        ++failures;
+    }
+}
+
+bool endsWith(const std::string &text, const char *suffix)
+{
+    size_t length = strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+void checkPolicy(SerialTxQueue::OverflowPolicy policy, const char *name, const char *expectedTail)
+{
+    StallingTarget target;
+    SerialTxQueue queue(target, policy);
+
+    // 줄바꿈 예약분만 남기고 열린 줄로 채움 → 넘치는 줄 → 다시 출력
+    std::string fill(BULK_LANE_SIZE - LINE_END_RESERVE, 'x');
+    const char *steps[] = {fill.c_str(), "overflow\r\n", "after\r\n", "again\r\n"};
+    for (const char *step : steps)
+    {
+        queue.print(step);
+        expect(queue.getPendingBytes() <= BULK_LANE_SIZE, name, "pending bytes exceed lane size");
+        expect(queue.availableForWrite() >= 0, name, "negative free space");
+    }
+    expect(queue.getBulkStats().droppedNewBytes + queue.getBulkStats().droppedOldBytes > 0, name,
+           "lane never overflowed");
+
+    target.open = true;
+    queue.drainAll();
+    expect(queue.isEmpty(), name, "queue not empty after drainAll");
+    expect(target.received.size() <= BULK_LANE_SIZE, name, "sent more bytes than the lane holds");
+    expect(endsWith(target.received, expectedTail), name, "unexpected tail after overflow");
+
+    // 넘침이 끝난 뒤의 줄은 온전히 전송
+    target.received.clear();
+    queue.print("next\r\n");
+    queue.drainAll();
+    expect(target.received == "next\r\n", name, "line after overflow not delivered");
+
+    // 빈 쓰기(UI_TEXT_ENGLISH의 빈 접미 문구 등)는 아무것도 넣지 않음, 가득 찬 레인에서도 줄바꿈을 끼우지 않음
+    target.received.clear();
+    target.open = false;
+    expect(queue.write(reinterpret_cast<const uint8_t *>(""), 0) == 0, name, "empty write queued bytes");
+    queue.print(fill.c_str());
+    uint16_t pending = queue.getPendingBytes();
+    queue.print("");
+    expect(queue.getPendingBytes() == pending, name, "empty write changed a full lane");
+    queue.print("\r\n");
+    target.open = true;
+    queue.drainAll();
+    expect(target.received == fill + "\r\n", name, "empty write altered the line");
+
+    printf("[%s] high water %u / %u B, dropped new %lu B, dropped old %lu B\n", name,
+           queue.getBulkStats().highWater, BULK_LANE_SIZE,
+           static_cast<unsigned long>(queue.getBulkStats().droppedNewBytes),
+           static_cast<unsigned long>(queue.getBulkStats().droppedOldBytes));
+}
+} // namespace
+
+int main()
+{
+    // DropNew: 채운 줄은 예약분의 줄바꿈으로 끝맺고 넘친 뒤 줄은 모두 버림
+    checkPolicy(SerialTxQueue::OverflowPolicy::DropNew, "drop new", "xx\r\n");
+    // DropOldest: 채운 줄을 버리고 최신 줄을 보존
+    checkPolicy(SerialTxQueue::OverflowPolicy::DropOldest, "drop oldest", "again\r\n");
+
+    if (failures)
+    {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,79 @@
+// UI 문구 테이블 크기 리포트 (호스트용)
+//
+// 빌드: g++ -std=c++17 -O2 -I src tools/bench/ui_text_report.cpp -o ui_text_report
+// 사용: ui_text_report [상위 N개]   (기본 10)
+//
+// src/domain/UiText.h의 항목별 한국어/영어 문자열 크기('\0' 포함 UTF-8 바이트)를 합산해
+// 언어 선택(-D UI_TEXT_ENGLISH=1)에 따른 플래시 문자열 데이터 차이를 출력한다.
+// 문자열은 두 언어 모두 .rodata에 위치하므로 RAM 사용량은 언어와 무관하다.
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "domain/UiText.h"
+
+namespace
+{
+struct Entry
+{
+    const char *id;
+    const char *ko;
+    const char *en;
+};
+
+const Entry ENTRIES[] = {
+#define UI_TEXT_REPORT_ENTRY(id, ko, en) {#id, ko, en},
+    UI_TEXT_TABLE(UI_TEXT_REPORT_ENTRY)
+#undef UI_TEXT_REPORT_ENTRY
+};
+
+size_t bytesOf(const char *text)
+{
+    return strlen(text) + 1;
+}
+
+// 영어로 바꿨을 때 줄어드는 바이트 (영어가 더 길면 음수)
+long savingOf(const Entry *entry)
+{
+    return static_cast<long>(bytesOf(entry->ko)) - static_cast<long>(bytesOf(entry->en));
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    size_t top = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10;
+    const size_t count = sizeof(ENTRIES) / sizeof(ENTRIES[0]);
+
+    size_t koBytes = 0;
+    size_t enBytes = 0;
+    for (const Entry &entry : ENTRIES)
+    {
+        koBytes += bytesOf(entry.ko);
+        enBytes += bytesOf(entry.en);
+    }
+
+    printf("항목 수          %zu\n", count);
+    printf("한국어 문자열    %zu B\n", koBytes);
+    printf("영어 문자열      %zu B\n", enBytes);
+    printf("영어 빌드 절감   %zu B (플래시)\n", koBytes - enBytes);
+    printf("포인터 테이블    0 B (상수 ID는 컴파일 시 문자열 주소로 치환)\n");
+
+    // 영어로 바꿨을 때 가장 많이 줄어드는 항목
+    std::vector<const Entry *> sorted;
+    for (const Entry &entry : ENTRIES)
+    {
+        sorted.push_back(&entry);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Entry *a, const Entry *b) {
+        return savingOf(a) > savingOf(b);
+    });
+
+    printf("\n%-30s %6s %6s %6s\n", "ID", "ko", "en", "saved");
+    for (size_t i = 0; i < top && i < sorted.size(); ++i)
+    {
+        printf("%-30s %6zu %6zu %6ld\n", sorted[i]->id, bytesOf(sorted[i]->ko), bytesOf(sorted[i]->en),
+               savingOf(sorted[i]));
+    }
+    return 0;
+}
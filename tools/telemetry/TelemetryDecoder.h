@@ -0,0 +1,111 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "domain/TelemetryProtocol.h"
+
+/**
+ * @brief 호스트용 바이너리 텔레메트리 스트림 디코더
+ *
+ * 수신 바이트를 0x00 구분자로 프레임 단위로 모아 COBS/CRC를 검사하고,
+ * 순번(sequence) 불연속으로 누락된 프레임 수를 센다. 텍스트 출력이 섞이거나
+ * 중간에 접속해도 다음 0x00에서 다시 동기화된다.
+ */
+class TelemetryDecoder
+{
+public:
+    struct Stats
+    {
+        uint32_t frames;        // CRC 통과 프레임
+        uint32_t crcErrors;     // COBS/CRC/형식 오류로 버린 프레임
+        uint32_t overruns;      // 최대 길이 초과로 버린 구간 (섞인 텍스트 포함)
+        uint32_t droppedFrames; // 순번 불연속으로 추정한 누락 프레임 수
+    };
+
+    // 프레임 하나를 받을 때마다 호출 (payload는 헤더 + 본문, CRC 제외)
+    using FrameHandler = void (*)(const Telemetry::Header &header, const uint8_t *body, void *context);
+
+    TelemetryDecoder(FrameHandler handler, void *context)
+        : handler(handler), context(context), length(0), overrun(false), hasSequence(false), lastSequence(0), stats()
+    {
+    }
+
+    void feed(const uint8_t *data, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            feed(data[i]);
+        }
+    }
+
+    void feed(uint8_t byte)
+    {
+        if (byte != 0x00)
+        {
+            if (length < sizeof(encoded))
+                encoded[length++] = byte;
+            else
+                overrun = true;
+            return;
+        }
+
+        if (overrun)
+            ++stats.overruns;
+        else if (length > 0)
+            processFrame();
+        length = 0;
+        overrun = false;
+    }
+
+    const Stats &getStats() const { return stats; }
+
+private:
+    FrameHandler handler;
+    void *context;
+    uint8_t encoded[Telemetry::MAX_FRAME_SIZE];
+    uint8_t payload[Telemetry::MAX_PAYLOAD_SIZE];
+    size_t length;
+    bool overrun;
+    bool hasSequence;
+    uint16_t lastSequence;
+    Stats stats;
+
+    static size_t entrySizeOf(uint8_t type)
+    {
+        if (type == Telemetry::FRAME_ROM_MAP)
+            return sizeof(Telemetry::RomEntry);
+        if (type == Telemetry::FRAME_LOG)
+            return sizeof(Telemetry::LogRecord);
+        return sizeof(Telemetry::Sample);
+    }
+
+    void processFrame()
+    {
+        size_t size = Telemetry::decodeFrame(encoded, length, payload, sizeof(payload));
+        Telemetry::Header header;
+        if (size < sizeof(header))
+        {
+            ++stats.crcErrors;
+            return;
+        }
+
+        memcpy(&header, payload, sizeof(header));
+        if (header.version != Telemetry::PROTOCOL_VERSION || size != sizeof(header) + header.count * entrySizeOf(header.type))
+        {
+            ++stats.crcErrors;
+            return;
+        }
+
+        // 16비트 순번 랩어라운드 고려 (로그 프레임의 순번은 레코드 번호이므로 제외)
+        if (header.type != Telemetry::FRAME_LOG)
+        {
+            if (hasSequence)
+                stats.droppedFrames += static_cast<uint16_t>(header.sequence - lastSequence - 1);
+            hasSequence = true;
+            lastSequence = header.sequence;
+        }
+        ++stats.frames;
+
+        handler(header, payload + sizeof(header), context);
+    }
+};
@@ -0,0 +1,94 @@
+// 바이너리 텔레메트리 디코더 (호스트용)
+//
+// 빌드: g++ -std=c++17 -O2 -I src -I tools/telemetry tools/telemetry/decode_telemetry.cpp -o decode_telemetry
+// 사용: decode_telemetry [캡처 파일]   (파일 생략 시 stdin, 예: 시리얼 포트를 raw 모드로 연결)
+//
+// 측정 프레임을 CSV(seq,ms,slot,rom,temp_c,flags)로 출력하고 종료 시 통계를 stderr에 출력한다.
+#include <cstdio>
+#include <cstring>
+#include "TelemetryDecoder.h"
+
+namespace
+{
+struct SlotMap
+{
+    bool known[256];
+    uint8_t rom[256][8];
+};
+
+void printRom(const uint8_t *rom)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        printf("%02X", rom[i]);
+    }
+}
+
+void onFrame(const Telemetry::Header &header, const uint8_t *body, void *context)
+{
+    SlotMap &map = *static_cast<SlotMap *>(context);
+
+    if (header.type == Telemetry::FRAME_ROM_MAP)
+    {
+        for (uint8_t i = 0; i < header.count; ++i)
+        {
+            Telemetry::RomEntry entry;
+            memcpy(&entry, body + i * sizeof(entry), sizeof(entry));
+            map.known[entry.slot] = true;
+            memcpy(map.rom[entry.slot], entry.rom, sizeof(entry.rom));
+        }
+        return;
+    }
+
+    if (header.type != Telemetry::FRAME_SAMPLES && header.type != Telemetry::FRAME_DELTA)
+        return;
+
+    for (uint8_t i = 0; i < header.count; ++i)
+    {
+        Telemetry::Sample sample;
+        memcpy(&sample, body + i * sizeof(sample), sizeof(sample));
+
+        printf("%u,%lu,%u,", header.sequence, static_cast<unsigned long>(header.timestampMs), sample.slot);
+        if (map.known[sample.slot])
+            printRom(map.rom[sample.slot]);
+        printf(",");
+        if (sample.flags & Telemetry::FLAG_VALID)
+            printf("%.4f", static_cast<double>(sample.raw) / Telemetry::RAW_PER_DEGREE);
+        printf(",0x%02X\n", sample.flags);
+    }
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    FILE *input = stdin;
+    if (argc > 1)
+    {
+        input = fopen(argv[1], "rb");
+        if (!input)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    static SlotMap map = {};
+    TelemetryDecoder decoder(onFrame, &map);
+
+    printf("seq,ms,slot,rom,temp_c,flags\n");
+    uint8_t buffer[256];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), input)) > 0)
+    {
+        decoder.feed(buffer, read);
+        fflush(stdout);
+    }
+
+    const TelemetryDecoder::Stats &stats = decoder.getStats();
+    fprintf(stderr, "frames=%u crc_errors=%u overruns=%u dropped=%u\n",
+            stats.frames, stats.crcErrors, stats.overruns, stats.droppedFrames);
+
+    if (input != stdin)
+        fclose(input);
+    return 0;
+}
@@ -0,0 +1,143 @@
+// 바이너리 추적 로그 디코더 (호스트용)
+//
+// 빌드: g++ -std=c++17 -O2 -I src -I tools/telemetry tools/telemetry/decode_trace.cpp -o decode_trace
+// 사용: decode_trace [캡처 파일]   (파일 생략 시 stdin)
+//
+// 'trace' 명령이 내보낸 FRAME_LOG 프레임을 src/domain/LogCatalog.h의 형식 문자열로
+// "번호 시각ms 메시지" 줄로 복원한다. 측정 프레임과 텍스트 출력은 건너뛴다.
+// 레코드 번호가 건너뛰면 링에서 덮어써졌거나 수신 중 유실된 것으로 보고 건수를 표시한다.
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include "TelemetryDecoder.h"
+#include "domain/LogCatalog.h"
+
+namespace
+{
+struct TraceState
+{
+    bool hasRecord;
+    uint16_t nextRecord; // 다음에 올 레코드 번호 (하위 16비트)
+    uint32_t records;
+    uint32_t missing;
+    uint32_t unknownIds;
+};
+
+// 형식 문자열에 인자를 채워 출력 (%d %u %X %t, 나머지 문자는 그대로)
+void printRecord(const Telemetry::LogRecord &record, TraceState &state)
+{
+    if (record.id >= static_cast<uint16_t>(LogId::COUNT))
+    {
+        ++state.unknownIds;
+        printf("(알 수 없는 ID %u)\n", record.id);
+        return;
+    }
+
+    const char *format = LogCatalog::FORMAT[record.id];
+    uint8_t used = 0;
+    for (const char *p = format; *p; ++p)
+    {
+        if (*p != '%')
+        {
+            putchar(*p);
+            continue;
+        }
+
+        char spec = *++p;
+        if (spec == '%')
+        {
+            putchar('%');
+            continue;
+        }
+        if (spec == '\0')
+            break;
+
+        int32_t value = (used < record.argCount && used < Telemetry::LOG_MAX_ARGS) ? record.args[used] : 0;
+        ++used;
+        switch (spec)
+        {
+        case 'u':
+            printf("%" PRIu32, static_cast<uint32_t>(value));
+            break;
+        case 'X':
+            printf("%" PRIX32, static_cast<uint32_t>(value));
+            break;
+        case 't':
+            printf("%s%" PRId32 ".%02" PRId32, value < 0 ? "-" : "", (value < 0 ? -value : value) / 100,
+                   (value < 0 ? -value : value) % 100);
+            break;
+        default:
+            printf("%" PRId32, value);
+            break;
+        }
+    }
+    putchar('\n');
+}
+
+void onFrame(const Telemetry::Header &header, const uint8_t *body, void *context)
+{
+    if (header.type != Telemetry::FRAME_LOG)
+        return;
+
+    TraceState &state = *static_cast<TraceState *>(context);
+
+    for (uint8_t i = 0; i < header.count; ++i)
+    {
+        uint16_t number = static_cast<uint16_t>(header.sequence + i);
+        if (state.hasRecord)
+        {
+            // 덤프마다 보관 중인 레코드 전체를 다시 보내므로 이미 출력한 번호는 건너뜀
+            int16_t gap = static_cast<int16_t>(number - state.nextRecord);
+            if (gap < 0)
+                continue;
+            if (gap > 0)
+            {
+                state.missing += gap;
+                printf("... %d건 없음 (링 덮어쓰기 또는 유실)\n", gap);
+            }
+        }
+
+        Telemetry::LogRecord record;
+        memcpy(&record, body + i * sizeof(record), sizeof(record));
+
+        printf("%u %" PRIu32 "ms ", number, record.timestampMs);
+        printRecord(record, state);
+        ++state.records;
+        state.hasRecord = true;
+        state.nextRecord = static_cast<uint16_t>(number + 1);
+    }
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    FILE *input = stdin;
+    if (argc > 1)
+    {
+        input = fopen(argv[1], "rb");
+        if (!input)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    static TraceState state = {};
+    TelemetryDecoder decoder(onFrame, &state);
+
+    uint8_t buffer[256];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), input)) > 0)
+    {
+        decoder.feed(buffer, read);
+        fflush(stdout);
+    }
+
+    const TelemetryDecoder::Stats &stats = decoder.getStats();
+    fprintf(stderr, "records=%u missing=%u unknown_ids=%u frames=%u crc_errors=%u\n",
+            state.records, state.missing, state.unknownIds, stats.frames, stats.crcErrors);
+
+    if (input != stdin)
+        fclose(input);
+    return 0;
+}